@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ENGINE_BITOPS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace Engine {
+namespace BitOps {
+
+    // Portable word-level bit helpers for packed bitsets (C++17, no <bit>).
+
+    /// Index of the lowest set bit. Undefined for word == 0.
+    inline int CountTrailingZeros(uint64_t word) {
+#if defined(_MSC_VER) && defined(_WIN64)
+        unsigned long index;
+        _BitScanForward64(&index, word);
+        return static_cast<int>(index);
+#elif defined(_MSC_VER)
+        unsigned long index;
+        if (static_cast<uint32_t>(word) != 0) {
+            _BitScanForward(&index, static_cast<uint32_t>(word));
+            return static_cast<int>(index);
+        }
+        _BitScanForward(&index, static_cast<uint32_t>(word >> 32));
+        return static_cast<int>(index) + 32;
+#else
+        return __builtin_ctzll(word);
+#endif
+    }
+
+    /// Number of set bits.
+    inline int PopCount(uint64_t word) {
+#if defined(_MSC_VER) && defined(_WIN64)
+        return static_cast<int>(__popcnt64(word));
+#elif defined(_MSC_VER)
+        return static_cast<int>(__popcnt(static_cast<uint32_t>(word)) +
+                                __popcnt(static_cast<uint32_t>(word >> 32)));
+#else
+        return __builtin_popcountll(word);
+#endif
+    }
+
+    /// Call func(index) for every set bit in words[0..wordCount), lowest index first.
+    /// Empty words cost one compare.
+    template<typename Func>
+    inline void ForEachSetBit(const uint64_t* words, size_t wordCount, Func&& func) {
+        for (size_t w = 0; w < wordCount; ++w) {
+            uint64_t word = words[w];
+            while (word != 0) {
+                int bit = CountTrailingZeros(word);
+                func(static_cast<uint32_t>(w * 64 + static_cast<size_t>(bit)));
+                word &= word - 1; // clear lowest set bit
+            }
+        }
+    }
+
+    // Whole-plane operations over packed words, two words per SSE2 step.
+
+    /// Zero words[0..wordCount).
+    inline void ClearWords(uint64_t* words, size_t wordCount) {
+        size_t w = 0;
+#if defined(ENGINE_BITOPS_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        for (; w + 2 <= wordCount; w += 2) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(words + w), zero);
+        }
+#endif
+        for (; w < wordCount; ++w) {
+            words[w] = 0;
+        }
+    }
+
+    /// dst |= src over wordCount words.
+    inline void OrWords(uint64_t* dst, const uint64_t* src, size_t wordCount) {
+        size_t w = 0;
+#if defined(ENGINE_BITOPS_SSE2)
+        for (; w + 2 <= wordCount; w += 2) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + w));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + w));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + w), _mm_or_si128(a, b));
+        }
+#endif
+        for (; w < wordCount; ++w) {
+            dst[w] |= src[w];
+        }
+    }
+
+    /// Total set bits in words[0..wordCount).
+    inline size_t CountSetBits(const uint64_t* words, size_t wordCount) {
+        size_t total = 0;
+        size_t w = 0;
+#if defined(ENGINE_BITOPS_SSE2)
+        // SWAR popcount per byte, then _mm_sad_epu8 sums bytes per 64-bit lane
+        const __m128i m1 = _mm_set1_epi8(0x55);
+        const __m128i m2 = _mm_set1_epi8(0x33);
+        const __m128i m4 = _mm_set1_epi8(0x0F);
+        const __m128i zero = _mm_setzero_si128();
+        __m128i sums = _mm_setzero_si128();
+        for (; w + 2 <= wordCount; w += 2) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + w));
+            v = _mm_sub_epi8(v, _mm_and_si128(_mm_srli_epi64(v, 1), m1));
+            v = _mm_add_epi8(_mm_and_si128(v, m2), _mm_and_si128(_mm_srli_epi64(v, 2), m2));
+            v = _mm_and_si128(_mm_add_epi8(v, _mm_srli_epi64(v, 4)), m4);
+            sums = _mm_add_epi64(sums, _mm_sad_epu8(v, zero));
+        }
+        uint64_t lanes[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sums);
+        total = static_cast<size_t>(lanes[0] + lanes[1]);
+#endif
+        for (; w < wordCount; ++w) {
+            total += static_cast<size_t>(PopCount(words[w]));
+        }
+        return total;
+    }
+
+} // namespace BitOps
+} // namespace Engine
@@ -0,0 +1,84 @@
+#include "ThreadPool.h"
+
+namespace Engine {
+
+    ThreadPool::ThreadPool(size_t threadCount)
+        : m_threadCount(threadCount > 1 ? threadCount : 1) {
+        size_t workerCount = m_threadCount - 1;
+        m_workers.reserve(workerCount);
+        for (size_t i = 0; i < workerCount; ++i) {
+            m_workers.emplace_back(&ThreadPool::WorkerLoop, this, i + 1);
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for (auto& worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    void ThreadPool::ParallelFor(size_t count, const RangeFunc& func) {
+        if (count == 0) return;
+
+        if (m_workers.empty()) {
+            func(0, count, 0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_job = &func;
+            m_jobCount = count;
+            m_pending = m_workers.size();
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        size_t begin, end;
+        GetRange(count, GetThreadCount(), 0, begin, end);
+        if (begin < end) {
+            func(begin, end, 0);
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]() { return m_pending == 0; });
+        m_job = nullptr;
+    }
+
+    void ThreadPool::WorkerLoop(size_t rangeIndex) {
+        size_t seenGeneration = 0;
+        for (;;) {
+            const RangeFunc* job;
+            size_t count;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wake.wait(lock, [&]() { return m_stopping || m_generation != seenGeneration; });
+                if (m_stopping) return;
+                seenGeneration = m_generation;
+                job = m_job;
+                count = m_jobCount;
+            }
+
+            size_t begin, end;
+            GetRange(count, GetThreadCount(), rangeIndex, begin, end);
+            if (begin < end) {
+                (*job)(begin, end, rangeIndex);
+            }
+
+            bool last;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                last = (--m_pending == 0);
+            }
+            if (last) {
+                m_done.notify_one();
+            }
+        }
+    }
+
+} // namespace Engine
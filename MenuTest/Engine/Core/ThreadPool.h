@@ -0,0 +1,63 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine {
+
+    /// Fixed-size pool of persistent worker threads for data-parallel loops.
+    /// ParallelFor splits [0, count) into one contiguous range per thread;
+    /// range r always goes to the same rangeIndex, so callers can keep
+    /// per-range output buffers and merge them in range order for results
+    /// that do not depend on scheduling.
+    /// The calling thread runs range 0, so a pool of N threads owns N - 1 workers.
+    /// Not re-entrant: ParallelFor must not be called from inside a job.
+    class ThreadPool {
+    public:
+        /// Job signature: func(begin, end, rangeIndex).
+        using RangeFunc = std::function<void(size_t, size_t, size_t)>;
+
+        explicit ThreadPool(size_t threadCount);
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /// Total threads taking part in ParallelFor, including the caller.
+        size_t GetThreadCount() const { return m_threadCount; }
+
+        /// Run func over [0, count) split into GetThreadCount() ranges and
+        /// block until every range has finished. Empty ranges are skipped.
+        void ParallelFor(size_t count, const RangeFunc& func);
+
+        /// Bounds of range rangeIndex when [0, count) is split into rangeCount parts.
+        static void GetRange(size_t count, size_t rangeCount, size_t rangeIndex,
+                             size_t& begin, size_t& end) {
+            size_t base = count / rangeCount;
+            size_t extra = count % rangeCount;
+            begin = rangeIndex * base + (rangeIndex < extra ? rangeIndex : extra);
+            end = begin + base + (rangeIndex < extra ? 1 : 0);
+        }
+
+    private:
+        void WorkerLoop(size_t rangeIndex);
+
+        size_t m_threadCount;
+        std::vector<std::thread> m_workers;
+        std::mutex m_mutex;
+        std::condition_variable m_wake;
+        std::condition_variable m_done;
+
+        // Current job, guarded by m_mutex
+        const RangeFunc* m_job = nullptr;
+        size_t m_jobCount = 0;
+        size_t m_generation = 0;
+        size_t m_pending = 0;
+        bool m_stopping = false;
+    };
+
+} // namespace Engine
@@ -0,0 +1,68 @@
+#include "../../Tests/SimpleTest.h"
+#include "ThreadPool.h"
+#include <atomic>
+
+using namespace Engine;
+using namespace SimpleTest;
+
+TEST_CASE(ThreadPool_GetRange_CoversCountContiguously) {
+    size_t expectedBegin = 0;
+    for (size_t r = 0; r < 4; ++r) {
+        size_t begin, end;
+        ThreadPool::GetRange(10, 4, r, begin, end);
+        ASSERT_EQUAL(begin, expectedBegin);
+        ASSERT_TRUE(end - begin == 2 || end - begin == 3);
+        expectedBegin = end;
+    }
+    ASSERT_EQUAL(expectedBegin, (size_t)10);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(ThreadPool_SingleThread_RunsInline) {
+    ThreadPool pool(1);
+    ASSERT_EQUAL(pool.GetThreadCount(), (size_t)1);
+
+    size_t calls = 0;
+    pool.ParallelFor(100, [&](size_t begin, size_t end, size_t range) {
+        calls += (begin == 0 && end == 100 && range == 0) ? 1 : 100;
+    });
+    ASSERT_EQUAL(calls, (size_t)1);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(ThreadPool_ParallelFor_VisitsEveryIndexOnce) {
+    ThreadPool pool(4);
+    ASSERT_EQUAL(pool.GetThreadCount(), (size_t)4);
+
+    std::vector<int> hits(10000, 0);
+    std::vector<size_t> rangeSizes(4, 0);
+    for (int round = 0; round < 50; ++round) {
+        pool.ParallelFor(hits.size(), [&](size_t begin, size_t end, size_t range) {
+            for (size_t i = begin; i < end; ++i) hits[i]++;
+            rangeSizes[range] += end - begin;
+        });
+    }
+
+    bool allFifty = true;
+    for (int h : hits) allFifty = allFifty && (h == 50);
+    ASSERT_TRUE(allFifty);
+    ASSERT_EQUAL(rangeSizes[0], (size_t)(2500 * 50));
+    ASSERT_EQUAL(rangeSizes[3], (size_t)(2500 * 50));
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(ThreadPool_ParallelFor_FewerItemsThanThreads) {
+    ThreadPool pool(8);
+    std::atomic<int> calls{0};
+    std::atomic<int> total{0};
+    pool.ParallelFor(3, [&](size_t begin, size_t end, size_t) {
+        calls++;
+        total += static_cast<int>(end - begin);
+    });
+    ASSERT_EQUAL(calls.load(), 3);
+    ASSERT_EQUAL(total.load(), 3);
+
+    pool.ParallelFor(0, [&](size_t, size_t, size_t) { calls++; });
+    ASSERT_EQUAL(calls.load(), 3);
+    return TestResult{__FUNCTION__, true, ""};
+}
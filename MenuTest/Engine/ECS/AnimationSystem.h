@@ -0,0 +1,30 @@
+#pragma once
+
+#include "System.h"
+#include "ComponentStorage.h"
+#include "Components.h"
+
+namespace Engine {
+namespace ECS {
+
+    /// Advances AnimationState components in bulk.
+    /// Uses the same AdvanceAnimation step as AnimatedSprite::Update.
+    class AnimationSystem : public System {
+    public:
+        explicit AnimationSystem(ComponentStorage<AnimationState>& animations)
+            : m_animations(animations) {}
+
+        void Update(float deltaTime, EntityManager&) override {
+            m_animations.ForEach([deltaTime](EntityId, AnimationState& state) {
+                if (state.clips) {
+                    AdvanceAnimation(*state.clips, state.playback, deltaTime);
+                }
+            });
+        }
+
+    private:
+        ComponentStorage<AnimationState>& m_animations;
+    };
+
+} // namespace ECS
+} // namespace Engine
@@ -2,64 +2,99 @@
 
 #include "EntityManager.h"
 #include <vector>
-#include <unordered_map>
 #include <cassert>
 
 namespace Engine {
 namespace ECS {
 
-    /// Dense-array component storage with sparse lookup.
+    /// Change-detection query filters for ComponentStorage<T>::ForEach.
+    /// `since` is the tick a consumer last saw (the value AdvanceTick() returned
+    /// on its previous run, 0 for "everything"); entries stamped later match.
+    template<typename T> struct Added   { uint32_t since = 0; };
+    template<typename T> struct Changed { uint32_t since = 0; };  // includes Added
+    template<typename T> struct Removed { uint32_t since = 0; };
+
+    /// Dense-array component storage with sparse lookup (sparse set).
     /// Provides cache-friendly iteration over all components of type T
     /// and O(1) lookup/add/remove by EntityId.
+    /// The sparse array is indexed directly by EntityId — IDs come from
+    /// EntityManager's free-list so they stay small and dense, no hashing needed.
+    ///
+    /// Change detection: Add stamps an added/changed tick, GetMut/MarkChanged
+    /// stamp a changed tick, Remove appends to a removal log. Plain Get and
+    /// ForEach never stamp, so read-only access stays free. Consumers call
+    /// AdvanceTick() once per run and query with the tick from their last run.
     template<typename T>
     class ComponentStorage {
     public:
         /// Add a component to an entity. Returns reference to the stored component.
         T& Add(EntityId id, T component = T{}) {
             assert(id != INVALID_ENTITY);
-            auto it = m_sparse.find(id);
-            if (it != m_sparse.end()) {
+            uint32_t existing = SparseIndex(id);
+            if (existing != NPOS) {
                 // Overwrite existing
-                m_dense[it->second].second = std::move(component);
-                return m_dense[it->second].second;
+                m_dense[existing].second = std::move(component);
+                m_ticks[existing].changed = m_tick;
+                return m_dense[existing].second;
+            }
+            if (id >= m_sparse.size()) {
+                m_sparse.resize(static_cast<size_t>(id) + 1, NPOS);
             }
-            size_t idx = m_dense.size();
+            uint32_t idx = static_cast<uint32_t>(m_dense.size());
             m_dense.push_back({id, std::move(component)});
+            m_ticks.push_back({m_tick, m_tick});
             m_sparse[id] = idx;
             return m_dense[idx].second;
         }
 
         /// Remove a component from an entity. Swaps with last element for O(1).
         void Remove(EntityId id) {
-            auto it = m_sparse.find(id);
-            if (it == m_sparse.end()) return;
+            uint32_t idx = SparseIndex(id);
+            if (idx == NPOS) return;
 
-            size_t idx = it->second;
-            size_t last = m_dense.size() - 1;
+            uint32_t last = static_cast<uint32_t>(m_dense.size() - 1);
 
             if (idx != last) {
                 // Swap with last element
                 m_dense[idx] = std::move(m_dense[last]);
+                m_ticks[idx] = m_ticks[last];
                 m_sparse[m_dense[idx].first] = idx;
             }
             m_dense.pop_back();
-            m_sparse.erase(it);
+            m_ticks.pop_back();
+            m_sparse[id] = NPOS;
+            m_removed.push_back({id, m_tick});
         }
 
         /// Get a pointer to an entity's component, or nullptr if not present.
+        /// Does not mark the component changed; use GetMut for writes.
         T* Get(EntityId id) {
-            auto it = m_sparse.find(id);
-            return (it != m_sparse.end()) ? &m_dense[it->second].second : nullptr;
+            uint32_t idx = SparseIndex(id);
+            return (idx != NPOS) ? &m_dense[idx].second : nullptr;
         }
 
         const T* Get(EntityId id) const {
-            auto it = m_sparse.find(id);
-            return (it != m_sparse.end()) ? &m_dense[it->second].second : nullptr;
+            uint32_t idx = SparseIndex(id);
+            return (idx != NPOS) ? &m_dense[idx].second : nullptr;
+        }
+
+        /// Get a component for writing and stamp it changed at the current tick.
+        T* GetMut(EntityId id) {
+            uint32_t idx = SparseIndex(id);
+            if (idx == NPOS) return nullptr;
+            m_ticks[idx].changed = m_tick;
+            return &m_dense[idx].second;
+        }
+
+        /// Stamp a component changed without fetching it (after an in-place write).
+        void MarkChanged(EntityId id) {
+            uint32_t idx = SparseIndex(id);
+            if (idx != NPOS) m_ticks[idx].changed = m_tick;
         }
 
         /// Check if an entity has this component.
         bool Has(EntityId id) const {
-            return m_sparse.find(id) != m_sparse.end();
+            return SparseIndex(id) != NPOS;
         }
 
         /// Number of components stored.
@@ -80,9 +115,65 @@ namespace ECS {
             }
         }
 
-        /// Clear all stored components.
+        /// Iterate (EntityId, const T&) for components added after filter.since.
+        template<typename Func>
+        void ForEach(Added<T> filter, Func&& func) const {
+            for (size_t i = 0; i < m_dense.size(); ++i) {
+                if (m_ticks[i].added > filter.since) func(m_dense[i].first, m_dense[i].second);
+            }
+        }
+
+        /// Iterate (EntityId, const T&) for components added or changed after filter.since.
+        template<typename Func>
+        void ForEach(Changed<T> filter, Func&& func) const {
+            for (size_t i = 0; i < m_dense.size(); ++i) {
+                if (m_ticks[i].changed > filter.since) func(m_dense[i].first, m_dense[i].second);
+            }
+        }
+
+        /// Iterate EntityIds whose component was removed after filter.since.
+        /// An ID may appear more than once if it was removed, re-added and removed again.
+        template<typename Func>
+        void ForEach(Removed<T> filter, Func&& func) const {
+            // Log is appended in tick order; skip the already-seen prefix
+            size_t i = m_removed.size();
+            while (i > 0 && m_removed[i - 1].tick > filter.since) --i;
+            for (; i < m_removed.size(); ++i) {
+                func(m_removed[i].id);
+            }
+        }
+
+        /// Current change tick (stamped on writes).
+        uint32_t GetTick() const { return m_tick; }
+
+        /// Close the current tick and return it. Every write so far is stamped
+        /// <= the returned value; later writes are stamped after it.
+        uint32_t AdvanceTick() { return m_tick++; }
+
+        /// Drop removal-log entries no consumer needs (stamped <= upToTick).
+        void TrimRemoved(uint32_t upToTick) {
+            size_t n = 0;
+            while (n < m_removed.size() && m_removed[n].tick <= upToTick) ++n;
+            m_removed.erase(m_removed.begin(), m_removed.begin() + n);
+        }
+
+        /// Per-frame housekeeping for owners: advances the tick and drops removals
+        /// older than the previous frame, so every consumer running once per frame
+        /// still sees each removal while the log stays bounded.
+        void EndFrame() {
+            TrimRemoved(m_lastFrameTick);
+            m_lastFrameTick = AdvanceTick();
+        }
+
+        size_t GetRemovedLogSize() const { return m_removed.size(); }
+
+        /// Clear all stored components (logged as removals).
         void Clear() {
+            for (const auto& entry : m_dense) {
+                m_removed.push_back({entry.first, m_tick});
+            }
             m_dense.clear();
+            m_ticks.clear();
             m_sparse.clear();
         }
 
@@ -90,8 +181,28 @@ namespace ECS {
         const std::vector<std::pair<EntityId, T>>& GetDenseArray() const { return m_dense; }
 
     private:
+        static constexpr uint32_t NPOS = UINT32_MAX;
+
+        struct Ticks {
+            uint32_t added;
+            uint32_t changed;
+        };
+
+        struct RemovedEntry {
+            EntityId id;
+            uint32_t tick;
+        };
+
+        uint32_t SparseIndex(EntityId id) const {
+            return (id < m_sparse.size()) ? m_sparse[id] : NPOS;
+        }
+
         std::vector<std::pair<EntityId, T>> m_dense;
-        std::unordered_map<EntityId, size_t> m_sparse;
+        std::vector<Ticks> m_ticks;      // Parallel to m_dense
+        std::vector<uint32_t> m_sparse;  // EntityId → dense index, NPOS if absent
+        std::vector<RemovedEntry> m_removed;
+        uint32_t m_tick = 1;             // 0 is reserved for "never seen"
+        uint32_t m_lastFrameTick = 0;
     };
 
 } // namespace ECS
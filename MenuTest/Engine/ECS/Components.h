@@ -0,0 +1,30 @@
+#pragma once
+
+#include "../Entity/Transform.h"
+#include "../Entity/SmoothMovement.h"
+#include "../Graphics/Animation.h"
+#include <vector>
+
+namespace Engine {
+namespace ECS {
+
+    // Shared component types for migrating per-object entity state into ECS storages.
+    // Plain engine value types (TilePosition, SmoothMovement) are stored directly
+    // as ComponentStorage<T>; the types below cover state that needs extra context.
+
+    /// Non-owning reference to an Entity's Transform.
+    /// The Transform stays on the Entity as the single source of truth for position
+    /// (SpatialGrid, renderers and selection read it); systems write through this pointer.
+    struct TransformRef {
+        Transform* transform = nullptr;
+    };
+
+    /// Animation playback cursor plus the clip set it indexes into.
+    /// Clips are owned by the entity's AnimatedSprite and never copied per entity.
+    struct AnimationState {
+        const std::vector<Animation>* clips = nullptr;
+        AnimationPlayback playback;
+    };
+
+} // namespace ECS
+} // namespace Engine
@@ -2,6 +2,10 @@
 #include "EntityManager.h"
 #include "ComponentStorage.h"
 #include "System.h"
+#include "MovementInterpolationSystem.h"
+#include "AnimationSystem.h"
+#include "SlotMap.h"
+#include <chrono>
 
 // ======================== EntityManager Tests ========================
 
@@ -118,6 +122,111 @@ TEST_CASE(EntityManager_ForEach) {
     return {"EntityManager_ForEach", true, ""};
 }
 
+TEST_CASE(EntityManager_ForEach_AscendingAcrossWords) {
+    Engine::ECS::EntityManager mgr;
+    auto handles = mgr.CreateEntities(200);
+    for (size_t i = 0; i < handles.size(); ++i) {
+        if (i % 3 != 0) mgr.DestroyEntity(handles[i]);
+    }
+
+    std::vector<Engine::ECS::EntityId> visited;
+    mgr.ForEach([&](Engine::ECS::EntityId id) { visited.push_back(id); });
+    ASSERT_EQUAL(visited.size(), mgr.GetEntityCount());
+    for (size_t i = 1; i < visited.size(); ++i) {
+        ASSERT_TRUE(visited[i - 1] < visited[i]);
+    }
+    return {"EntityManager_ForEach_AscendingAcrossWords", true, ""};
+}
+
+TEST_CASE(EntityManager_CreateEntities_Bulk) {
+    Engine::ECS::EntityManager mgr;
+    auto first = mgr.CreateEntities(5);
+    mgr.DestroyEntity(first[1]);
+    mgr.DestroyEntity(first[3]);
+
+    // Recycles the two freed IDs, then allocates fresh ones
+    auto wave = mgr.CreateEntities(4);
+    ASSERT_EQUAL(wave.size(), (size_t)4);
+    ASSERT_EQUAL(mgr.GetEntityCount(), (size_t)7);
+    for (const auto& h : wave) {
+        ASSERT_TRUE(mgr.IsAlive(h));
+    }
+    ASSERT_FALSE(mgr.IsAlive(first[1]));
+    ASSERT_FALSE(mgr.IsAlive(first[3]));
+    return {"EntityManager_CreateEntities_Bulk", true, ""};
+}
+
+TEST_CASE(EntityManager_DestroyEntities_SkipsStale) {
+    Engine::ECS::EntityManager mgr;
+    auto wave = mgr.CreateEntities(10);
+    mgr.DestroyEntity(wave[0]);
+    auto reused = mgr.CreateEntity(); // takes wave[0]'s slot with a new version
+
+    mgr.DestroyEntities(wave);
+    ASSERT_EQUAL(mgr.GetEntityCount(), (size_t)1);
+    ASSERT_TRUE(mgr.IsAlive(reused));
+    return {"EntityManager_DestroyEntities_SkipsStale", true, ""};
+}
+
+TEST_CASE(EntityManager_DenseAliveList_TracksCreateDestroy) {
+    Engine::ECS::EntityManager mgr;
+    auto early = mgr.CreateEntities(3);
+    mgr.SetDenseAliveList(true);
+    ASSERT_EQUAL(mgr.GetAliveList().size(), (size_t)3);
+
+    auto later = mgr.CreateEntities(3);
+    mgr.DestroyEntity(early[0]);
+    mgr.DestroyEntity(later[2]);
+    ASSERT_EQUAL(mgr.GetAliveList().size(), (size_t)4);
+
+    size_t visited = 0;
+    bool allAlive = true;
+    mgr.ForEach([&](Engine::ECS::EntityId id) {
+        allAlive = allAlive && mgr.IsAlive(id);
+        ++visited;
+    });
+    ASSERT_EQUAL(visited, (size_t)4);
+    ASSERT_TRUE(allAlive);
+
+    mgr.SetDenseAliveList(false);
+    ASSERT_EQUAL(mgr.GetAliveList().size(), (size_t)0);
+    return {"EntityManager_DenseAliveList_TracksCreateDestroy", true, ""};
+}
+
+TEST_CASE(EntityManager_ForEach_SparseAfterWave_Benchmark) {
+    // 100k-entity wave, 99% destroyed: iteration should track live entities
+    Engine::ECS::EntityManager bitsetMgr;
+    Engine::ECS::EntityManager denseMgr;
+    denseMgr.SetDenseAliveList(true);
+    for (auto* mgr : {&bitsetMgr, &denseMgr}) {
+        auto wave = mgr->CreateEntities(100000);
+        std::vector<Engine::ECS::EntityHandle> doomed;
+        for (size_t i = 0; i < wave.size(); ++i) {
+            if (i % 100 != 0) doomed.push_back(wave[i]);
+        }
+        mgr->DestroyEntities(doomed);
+    }
+
+    size_t sum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < 100; ++r) {
+        bitsetMgr.ForEach([&](Engine::ECS::EntityId id) { sum += id; });
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int r = 0; r < 100; ++r) {
+        denseMgr.ForEach([&](Engine::ECS::EntityId id) { sum += id; });
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto bitsetUs = std::chrono::duration_cast<std::chrono::microseconds>(mid - start).count();
+    auto denseUs = std::chrono::duration_cast<std::chrono::microseconds>(end - mid).count();
+    std::cout << "  [bench] EntityManager ForEach 1k alive / 100k peak x100: bitset "
+              << bitsetUs << " us, dense " << denseUs << " us" << std::endl;
+    ASSERT_TRUE(sum > 0);
+    ASSERT_TRUE(bitsetUs < 1000000);
+    return {"EntityManager_ForEach_SparseAfterWave_Benchmark", true, ""};
+}
+
 // ======================== ComponentStorage Tests ========================
 
 struct TestComponent {
@@ -211,3 +320,252 @@ TEST_CASE(ComponentStorage_DenseArrayIteration) {
     ASSERT_EQUAL(dense.size(), (size_t)2);
     return {"ComponentStorage_DenseArrayIteration", true, ""};
 }
+
+// ======================== System Tests ========================
+
+TEST_CASE(MovementInterpolationSystem_WritesTransform) {
+    Engine::ECS::EntityManager mgr;
+    Engine::ECS::ComponentStorage<Engine::SmoothMovement> movements;
+    Engine::ECS::ComponentStorage<Engine::ECS::TransformRef> transforms;
+    Engine::ECS::MovementInterpolationSystem system(movements, transforms);
+
+    Engine::Transform transform;
+    auto e = mgr.CreateEntity();
+    Engine::SmoothMovement movement;
+    movement.Start(0, 0, 100, 0, 1.0f);
+    movements.Add(e.id, movement);
+    transforms.Add(e.id, Engine::ECS::TransformRef{&transform});
+
+    system.Update(0.5f, mgr);
+    ASSERT_TRUE(transform.position.x > 0 && transform.position.x < 100);
+
+    system.Update(1.0f, mgr);
+    ASSERT_EQUAL(transform.position.x, 100);
+    ASSERT_FALSE(movements.Get(e.id)->isMoving);
+    return {"MovementInterpolationSystem_WritesTransform", true, ""};
+}
+
+TEST_CASE(MovementInterpolationSystem_SkipsIdle) {
+    Engine::ECS::EntityManager mgr;
+    Engine::ECS::ComponentStorage<Engine::SmoothMovement> movements;
+    Engine::ECS::ComponentStorage<Engine::ECS::TransformRef> transforms;
+    Engine::ECS::MovementInterpolationSystem system(movements, transforms);
+
+    Engine::Transform transform;
+    transform.SetPosition(7, 9);
+    auto e = mgr.CreateEntity();
+    movements.Add(e.id, Engine::SmoothMovement());
+    transforms.Add(e.id, Engine::ECS::TransformRef{&transform});
+
+    system.Update(0.5f, mgr);
+    ASSERT_EQUAL(transform.position.x, 7);
+    ASSERT_EQUAL(transform.position.y, 9);
+    return {"MovementInterpolationSystem_SkipsIdle", true, ""};
+}
+
+TEST_CASE(AnimationSystem_AdvancesAndLoops) {
+    std::vector<Engine::Animation> clips;
+    Engine::Animation walk("walk", true);
+    walk.frames.push_back(Engine::AnimationFrame(Engine::Rect(0, 0, 8, 8), 0.1f));
+    walk.frames.push_back(Engine::AnimationFrame(Engine::Rect(8, 0, 8, 8), 0.1f));
+    clips.push_back(walk);
+
+    Engine::ECS::EntityManager mgr;
+    Engine::ECS::ComponentStorage<Engine::ECS::AnimationState> animations;
+    Engine::ECS::AnimationSystem system(animations);
+
+    auto e = mgr.CreateEntity();
+    Engine::ECS::AnimationState state;
+    state.clips = &clips;
+    state.playback.Play(0);
+    animations.Add(e.id, state);
+
+    system.Update(0.15f, mgr);
+    ASSERT_EQUAL(animations.Get(e.id)->playback.frame, 1);
+    system.Update(0.1f, mgr);
+    ASSERT_EQUAL(animations.Get(e.id)->playback.frame, 0);
+    return {"AnimationSystem_AdvancesAndLoops", true, ""};
+}
+
+// ======================== Change Detection Tests ========================
+
+TEST_CASE(ComponentStorage_AddedFilter_OnlyNewSinceLastRun) {
+    Engine::ECS::ComponentStorage<TestComponent> storage;
+    storage.Add(1, TestComponent{1, 0.0f});
+    storage.Add(2, TestComponent{2, 0.0f});
+
+    uint32_t lastRun = storage.AdvanceTick();
+    storage.Add(3, TestComponent{3, 0.0f});
+
+    std::vector<Engine::ECS::EntityId> added;
+    storage.ForEach(Engine::ECS::Added<TestComponent>{lastRun},
+        [&](Engine::ECS::EntityId id, const TestComponent&) { added.push_back(id); });
+    ASSERT_EQUAL(added.size(), (size_t)1);
+    ASSERT_EQUAL(added[0], (Engine::ECS::EntityId)3);
+
+    size_t all = 0;
+    storage.ForEach(Engine::ECS::Added<TestComponent>{0},
+        [&](Engine::ECS::EntityId, const TestComponent&) { ++all; });
+    ASSERT_EQUAL(all, (size_t)3);
+    return {"ComponentStorage_AddedFilter_OnlyNewSinceLastRun", true, ""};
+}
+
+TEST_CASE(ComponentStorage_ChangedFilter_GetMutAndMarkChanged) {
+    Engine::ECS::ComponentStorage<TestComponent> storage;
+    storage.Add(1, TestComponent{1, 0.0f});
+    storage.Add(2, TestComponent{2, 0.0f});
+    storage.Add(3, TestComponent{3, 0.0f});
+    uint32_t lastRun = storage.AdvanceTick();
+
+    storage.GetMut(1)->value = 10;
+    storage.Get(2)->value = 20;     // plain Get does not stamp
+    storage.MarkChanged(3);
+
+    std::vector<Engine::ECS::EntityId> changed;
+    storage.ForEach(Engine::ECS::Changed<TestComponent>{lastRun},
+        [&](Engine::ECS::EntityId id, const TestComponent&) { changed.push_back(id); });
+    ASSERT_EQUAL(changed.size(), (size_t)2);
+    ASSERT_EQUAL(changed[0], (Engine::ECS::EntityId)1);
+    ASSERT_EQUAL(changed[1], (Engine::ECS::EntityId)3);
+
+    // Next run sees nothing new
+    lastRun = storage.AdvanceTick();
+    size_t again = 0;
+    storage.ForEach(Engine::ECS::Changed<TestComponent>{lastRun},
+        [&](Engine::ECS::EntityId, const TestComponent&) { ++again; });
+    ASSERT_EQUAL(again, (size_t)0);
+    return {"ComponentStorage_ChangedFilter_GetMutAndMarkChanged", true, ""};
+}
+
+TEST_CASE(ComponentStorage_ChangedFilter_SurvivesSwapRemove) {
+    Engine::ECS::ComponentStorage<TestComponent> storage;
+    storage.Add(1, TestComponent{1, 0.0f});
+    storage.Add(2, TestComponent{2, 0.0f});
+    uint32_t lastRun = storage.AdvanceTick();
+
+    storage.MarkChanged(2);
+    storage.Remove(1); // moves entity 2 into slot 0
+
+    std::vector<Engine::ECS::EntityId> changed;
+    storage.ForEach(Engine::ECS::Changed<TestComponent>{lastRun},
+        [&](Engine::ECS::EntityId id, const TestComponent&) { changed.push_back(id); });
+    ASSERT_EQUAL(changed.size(), (size_t)1);
+    ASSERT_EQUAL(changed[0], (Engine::ECS::EntityId)2);
+    return {"ComponentStorage_ChangedFilter_SurvivesSwapRemove", true, ""};
+}
+
+TEST_CASE(ComponentStorage_RemovedFilter_AndTrim) {
+    Engine::ECS::ComponentStorage<TestComponent> storage;
+    storage.Add(1, TestComponent{});
+    storage.Add(2, TestComponent{});
+    storage.Remove(1);
+    uint32_t lastRun = storage.AdvanceTick();
+    storage.Remove(2);
+
+    std::vector<Engine::ECS::EntityId> removed;
+    storage.ForEach(Engine::ECS::Removed<TestComponent>{lastRun},
+        [&](Engine::ECS::EntityId id) { removed.push_back(id); });
+    ASSERT_EQUAL(removed.size(), (size_t)1);
+    ASSERT_EQUAL(removed[0], (Engine::ECS::EntityId)2);
+
+    storage.TrimRemoved(lastRun);
+    ASSERT_EQUAL(storage.GetRemovedLogSize(), (size_t)1);
+    return {"ComponentStorage_RemovedFilter_AndTrim", true, ""};
+}
+
+TEST_CASE(ComponentStorage_EndFrame_BoundsRemovedLog) {
+    Engine::ECS::ComponentStorage<TestComponent> storage;
+    for (Engine::ECS::EntityId id = 1; id <= 100; ++id) {
+        storage.Add(id, TestComponent{});
+        storage.Remove(id);
+        storage.EndFrame();
+    }
+    // Only removals from the last frame or two are retained
+    ASSERT_TRUE(storage.GetRemovedLogSize() <= 2);
+    return {"ComponentStorage_EndFrame_BoundsRemovedLog", true, ""};
+}
+
+TEST_CASE(MovementInterpolationSystem_StampsMoversChanged) {
+    Engine::ECS::EntityManager mgr;
+    Engine::ECS::ComponentStorage<Engine::SmoothMovement> movements;
+    Engine::ECS::ComponentStorage<Engine::ECS::TransformRef> transforms;
+    Engine::ECS::MovementInterpolationSystem system(movements, transforms);
+
+    Engine::Transform a, b;
+    auto ea = mgr.CreateEntity();
+    auto eb = mgr.CreateEntity();
+    Engine::SmoothMovement moving;
+    moving.Start(0, 0, 10, 10, 1.0f);
+    movements.Add(ea.id, moving);
+    movements.Add(eb.id, Engine::SmoothMovement());
+    transforms.Add(ea.id, Engine::ECS::TransformRef{&a});
+    transforms.Add(eb.id, Engine::ECS::TransformRef{&b});
+
+    uint32_t lastRun = movements.AdvanceTick();
+    system.Update(0.1f, mgr);
+
+    std::vector<Engine::ECS::EntityId> changed;
+    movements.ForEach(Engine::ECS::Changed<Engine::SmoothMovement>{lastRun},
+        [&](Engine::ECS::EntityId id, const Engine::SmoothMovement&) { changed.push_back(id); });
+    ASSERT_EQUAL(changed.size(), (size_t)1);
+    ASSERT_EQUAL(changed[0], ea.id);
+    return {"MovementInterpolationSystem_StampsMoversChanged", true, ""};
+}
+
+// ======================== SlotMap Tests ========================
+
+TEST_CASE(SlotMap_InsertGetRemove) {
+    Engine::ECS::SlotMap<int> map;
+    auto a = map.Insert(10);
+    auto b = map.Insert(20);
+    ASSERT_TRUE(a.id != Engine::ECS::INVALID_ENTITY);
+    ASSERT_EQUAL(*map.Get(a), 10);
+    ASSERT_EQUAL(*map.Get(b), 20);
+
+    ASSERT_TRUE(map.Remove(a));
+    ASSERT_NULL(map.Get(a));
+    ASSERT_FALSE(map.Remove(a));
+    ASSERT_EQUAL(*map.Get(b), 20);   // survived the swap-remove
+    ASSERT_EQUAL(map.Size(), (size_t)1);
+    return {"SlotMap_InsertGetRemove", true, ""};
+}
+
+TEST_CASE(SlotMap_ReusedSlot_StaleHandleRejected) {
+    Engine::ECS::SlotMap<int> map;
+    auto a = map.Insert(1);
+    map.Remove(a);
+    auto b = map.Insert(2);
+    ASSERT_EQUAL(b.id, a.id);        // slot reused
+    ASSERT_TRUE(b.version != a.version);
+    ASSERT_NULL(map.Get(a));
+    ASSERT_EQUAL(*map.Get(b), 2);
+    return {"SlotMap_ReusedSlot_StaleHandleRejected", true, ""};
+}
+
+TEST_CASE(SlotMap_Clear_InvalidatesHandles) {
+    Engine::ECS::SlotMap<int> map;
+    auto a = map.Insert(1);
+    auto b = map.Insert(2);
+    map.Clear();
+    ASSERT_FALSE(map.Contains(a));
+    ASSERT_FALSE(map.Contains(b));
+    auto c = map.Insert(3);
+    ASSERT_TRUE(map.Contains(c));
+    ASSERT_EQUAL(map.Size(), (size_t)1);
+    return {"SlotMap_Clear_InvalidatesHandles", true, ""};
+}
+
+TEST_CASE(PagedIdMap_SetFindErase) {
+    Engine::ECS::PagedIdMap map;
+    map.Set(5, Engine::ECS::EntityHandle(1, 0));
+    map.Set(100000, Engine::ECS::EntityHandle(2, 3));
+    ASSERT_TRUE(map.Find(5) == Engine::ECS::EntityHandle(1, 0));
+    ASSERT_TRUE(map.Find(100000) == Engine::ECS::EntityHandle(2, 3));
+    ASSERT_FALSE(map.Find(6));
+    ASSERT_FALSE(map.Find(999999));
+
+    map.Erase(5);
+    ASSERT_FALSE(map.Find(5));
+    ASSERT_TRUE(map.Find(100000) == Engine::ECS::EntityHandle(2, 3));
+    return {"PagedIdMap_SetFindErase", true, ""};
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Core/Types.h"
+#include "../Core/BitOps.h"
 #include <vector>
 #include <cstdint>
 
@@ -15,8 +16,8 @@ namespace ECS {
         EntityId id;
         uint32_t version;
 
-        EntityHandle() : id(INVALID_ENTITY), version(0) {}
-        EntityHandle(EntityId i, uint32_t v) : id(i), version(v) {}
+        constexpr EntityHandle() : id(INVALID_ENTITY), version(0) {}
+        constexpr EntityHandle(EntityId i, uint32_t v) : id(i), version(v) {}
 
         bool operator==(const EntityHandle& o) const { return id == o.id && version == o.version; }
         bool operator!=(const EntityHandle& o) const { return !(*this == o); }
@@ -35,6 +36,10 @@ namespace ECS {
     /// Lightweight entity manager. Tracks alive entities and recycles IDs.
     /// Uses a free-list for O(1) create/destroy.
     /// Versioned handles detect use-after-destroy.
+    ///
+    /// Liveness is a packed 64-bit-word bitset; ForEach skips empty words, so
+    /// iteration costs O(peakId / 64 + alive). With the optional dense alive-list
+    /// enabled it costs O(alive) regardless of how many IDs were ever allocated.
     class EntityManager {
     public:
         EntityManager() : m_nextId(1) {}
@@ -46,43 +51,73 @@ namespace ECS {
                 m_freeList.pop_back();
             } else {
                 id = m_nextId++;
+                EnsureCapacity(m_nextId);
             }
-            if (id >= m_alive.size()) {
-                m_alive.resize(static_cast<size_t>(id) + 1, false);
-                m_versions.resize(static_cast<size_t>(id) + 1, 0);
-            }
-            m_alive[id] = true;
-            ++m_count;
+            MarkAlive(id);
             return EntityHandle(id, m_versions[id]);
         }
 
+        /// Create count entities at once (wave spawning). Recycled IDs are used
+        /// first; fresh IDs grow the slot arrays with a single resize.
+        void CreateEntities(size_t count, std::vector<EntityHandle>& out) {
+            out.reserve(out.size() + count);
+
+            size_t recycled = (count < m_freeList.size()) ? count : m_freeList.size();
+            size_t fresh = count - recycled;
+            if (fresh > 0) {
+                EnsureCapacity(m_nextId + static_cast<EntityId>(fresh));
+            }
+
+            for (size_t i = 0; i < recycled; ++i) {
+                EntityId id = m_freeList.back();
+                m_freeList.pop_back();
+                MarkAlive(id);
+                out.push_back(EntityHandle(id, m_versions[id]));
+            }
+            for (size_t i = 0; i < fresh; ++i) {
+                EntityId id = m_nextId++;
+                MarkAlive(id);
+                out.push_back(EntityHandle(id, m_versions[id]));
+            }
+        }
+
+        std::vector<EntityHandle> CreateEntities(size_t count) {
+            std::vector<EntityHandle> out;
+            CreateEntities(count, out);
+            return out;
+        }
+
         void DestroyEntity(EntityHandle handle) {
             EntityId id = handle.id;
-            if (id == INVALID_ENTITY || id >= m_alive.size() || !m_alive[id]) return;
+            if (!IsAliveSlot(id)) return;
             if (handle.version != m_versions[id]) return; // stale handle
-            m_alive[id] = false;
-            m_versions[id]++; // increment version so old handles become stale
-            m_freeList.push_back(id);
-            --m_count;
+            Release(id);
         }
 
         /// Legacy overload for raw IDs (use handle version when possible).
         void DestroyEntity(EntityId id) {
-            if (id == INVALID_ENTITY || id >= m_alive.size() || !m_alive[id]) return;
-            m_alive[id] = false;
-            m_versions[id]++;
-            m_freeList.push_back(id);
-            --m_count;
+            if (!IsAliveSlot(id)) return;
+            Release(id);
+        }
+
+        /// Destroy a contiguous range of handles. Stale and invalid handles are skipped.
+        void DestroyEntities(const EntityHandle* handles, size_t count) {
+            m_freeList.reserve(m_freeList.size() + count);
+            for (size_t i = 0; i < count; ++i) {
+                DestroyEntity(handles[i]);
+            }
+        }
+
+        void DestroyEntities(const std::vector<EntityHandle>& handles) {
+            DestroyEntities(handles.data(), handles.size());
         }
 
         bool IsAlive(EntityHandle handle) const {
-            EntityId id = handle.id;
-            return id != INVALID_ENTITY && id < m_alive.size() 
-                && m_alive[id] && handle.version == m_versions[id];
+            return IsAliveSlot(handle.id) && handle.version == m_versions[handle.id];
         }
 
         bool IsAlive(EntityId id) const {
-            return id != INVALID_ENTITY && id < m_alive.size() && m_alive[id];
+            return IsAliveSlot(id);
         }
 
         /// Get the current version for an entity slot.
@@ -92,20 +127,93 @@ namespace ECS {
 
         size_t GetEntityCount() const { return m_count; }
 
+        /// Maintain a dense list of alive IDs (swap-remove on destroy).
+        /// Costs one extra index per slot; makes ForEach O(alive).
+        void SetDenseAliveList(bool enabled) {
+            if (enabled == m_denseEnabled) return;
+            m_denseEnabled = enabled;
+            m_dense.clear();
+            m_denseIndex.clear();
+            if (!enabled) return;
+
+            m_denseIndex.assign(m_versions.size(), NPOS);
+            m_dense.reserve(m_count);
+            ScanBits([this](EntityId id) {
+                m_denseIndex[id] = static_cast<uint32_t>(m_dense.size());
+                m_dense.push_back(id);
+            });
+        }
+
+        bool HasDenseAliveList() const { return m_denseEnabled; }
+
+        /// Alive IDs in dense order (empty unless SetDenseAliveList(true)).
+        const std::vector<EntityId>& GetAliveList() const { return m_dense; }
+
         /// Iterate all alive entity IDs. Callback: void(EntityId).
+        /// Ascending ID order via the bitset, or dense-list order when enabled.
         template<typename Func>
         void ForEach(Func&& func) const {
-            for (EntityId id = 1; id < static_cast<EntityId>(m_alive.size()); ++id) {
-                if (m_alive[id]) func(id);
+            if (m_denseEnabled) {
+                for (EntityId id : m_dense) func(id);
+                return;
             }
+            ScanBits(func);
         }
 
     private:
-        std::vector<bool> m_alive;
+        static constexpr uint32_t NPOS = UINT32_MAX;
+
+        std::vector<uint64_t> m_aliveBits;
         std::vector<uint32_t> m_versions;
         std::vector<EntityId> m_freeList;
         EntityId m_nextId;
         size_t m_count = 0;
+
+        bool m_denseEnabled = false;
+        std::vector<EntityId> m_dense;
+        std::vector<uint32_t> m_denseIndex; // slot -> index in m_dense
+
+        bool IsAliveSlot(EntityId id) const {
+            return id != INVALID_ENTITY && id < m_versions.size()
+                && (m_aliveBits[id >> 6] >> (id & 63)) & 1u;
+        }
+
+        /// Grow slot arrays so IDs below slotCount are addressable.
+        void EnsureCapacity(EntityId slotCount) {
+            if (slotCount <= m_versions.size()) return;
+            m_versions.resize(slotCount, 0);
+            m_aliveBits.resize((static_cast<size_t>(slotCount) + 63) / 64, 0);
+            if (m_denseEnabled) m_denseIndex.resize(slotCount, NPOS);
+        }
+
+        void MarkAlive(EntityId id) {
+            m_aliveBits[id >> 6] |= (uint64_t(1) << (id & 63));
+            ++m_count;
+            if (m_denseEnabled) {
+                m_denseIndex[id] = static_cast<uint32_t>(m_dense.size());
+                m_dense.push_back(id);
+            }
+        }
+
+        void Release(EntityId id) {
+            m_aliveBits[id >> 6] &= ~(uint64_t(1) << (id & 63));
+            m_versions[id]++; // increment version so old handles become stale
+            m_freeList.push_back(id);
+            --m_count;
+            if (m_denseEnabled) {
+                uint32_t index = m_denseIndex[id];
+                EntityId last = m_dense.back();
+                m_dense[index] = last;
+                m_denseIndex[last] = index;
+                m_dense.pop_back();
+                m_denseIndex[id] = NPOS;
+            }
+        }
+
+        template<typename Func>
+        void ScanBits(Func&& func) const {
+            BitOps::ForEachSetBit(m_aliveBits.data(), m_aliveBits.size(), func);
+        }
     };
 
 } // namespace ECS
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "System.h"
+#include "ComponentStorage.h"
+#include "Components.h"
+
+namespace Engine {
+namespace ECS {
+
+    /// Advances SmoothMovement components in bulk and writes the interpolated
+    /// position through each entity's TransformRef.
+    /// Idle movers are skipped with a single flag test on the dense array;
+    /// active ones are stamped changed so Changed<SmoothMovement> sees them.
+    class MovementInterpolationSystem : public System {
+    public:
+        MovementInterpolationSystem(ComponentStorage<SmoothMovement>& movements,
+                                    ComponentStorage<TransformRef>& transforms)
+            : m_movements(movements)
+            , m_transforms(transforms) {}
+
+        void Update(float deltaTime, EntityManager&) override {
+            m_movements.ForEach([&](EntityId id, SmoothMovement& movement) {
+                if (!movement.isMoving) return;
+
+                int x, y;
+                movement.Update(deltaTime, x, y);
+                m_movements.MarkChanged(id);
+
+                TransformRef* ref = m_transforms.Get(id);
+                if (ref && ref->transform) {
+                    ref->transform->SetPosition(x, y);
+                }
+            });
+        }
+
+    private:
+        ComponentStorage<SmoothMovement>& m_movements;
+        ComponentStorage<TransformRef>& m_transforms;
+    };
+
+} // namespace ECS
+} // namespace Engine
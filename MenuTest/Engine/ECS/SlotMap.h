@@ -0,0 +1,179 @@
+#pragma once
+
+#include "EntityManager.h"
+#include <vector>
+#include <memory>
+#include <array>
+#include <cstdint>
+
+namespace Engine {
+namespace ECS {
+
+    /// Slot map: dense value storage addressed by generational handles.
+    /// Insert, Remove and Get are O(1) with no hashing. Values are packed
+    /// contiguously (swap-remove), so iteration touches only live entries.
+    /// Handle ids are slot indices starting at 1 (0 stays INVALID_ENTITY);
+    /// removing a value bumps the slot version so old handles go stale.
+    template<typename T>
+    class SlotMap {
+    public:
+        EntityHandle Insert(T value) {
+            uint32_t slot;
+            if (!m_freeSlots.empty()) {
+                slot = m_freeSlots.back();
+                m_freeSlots.pop_back();
+            } else {
+                slot = static_cast<uint32_t>(m_slots.size());
+                m_slots.push_back(Slot());
+            }
+
+            m_slots[slot].dense = static_cast<uint32_t>(m_values.size());
+            m_values.push_back(std::move(value));
+            m_denseToSlot.push_back(slot);
+            return EntityHandle(slot, m_slots[slot].version);
+        }
+
+        /// Remove the value for handle. The last dense value moves into its place.
+        bool Remove(EntityHandle handle) {
+            uint32_t index = DenseIndex(handle);
+            if (index == NPOS) return false;
+
+            uint32_t last = static_cast<uint32_t>(m_values.size() - 1);
+            if (index != last) {
+                m_values[index] = std::move(m_values[last]);
+                m_denseToSlot[index] = m_denseToSlot[last];
+                m_slots[m_denseToSlot[index]].dense = index;
+            }
+            m_values.pop_back();
+            m_denseToSlot.pop_back();
+
+            Slot& slot = m_slots[handle.id];
+            slot.dense = NPOS;
+            slot.version++;
+            m_freeSlots.push_back(handle.id);
+            return true;
+        }
+
+        T* Get(EntityHandle handle) {
+            uint32_t index = DenseIndex(handle);
+            return (index != NPOS) ? &m_values[index] : nullptr;
+        }
+
+        const T* Get(EntityHandle handle) const {
+            uint32_t index = DenseIndex(handle);
+            return (index != NPOS) ? &m_values[index] : nullptr;
+        }
+
+        bool Contains(EntityHandle handle) const { return DenseIndex(handle) != NPOS; }
+
+        /// Position of handle's value in the dense array, or NPOS if stale/invalid.
+        /// Remove swaps the last dense value into this position.
+        uint32_t DenseIndex(EntityHandle handle) const {
+            if (handle.id == INVALID_ENTITY || handle.id >= m_slots.size()) return NPOS;
+            const Slot& slot = m_slots[handle.id];
+            return (slot.version == handle.version) ? slot.dense : NPOS;
+        }
+
+        /// Handle for the value at a dense index.
+        EntityHandle HandleAt(uint32_t denseIndex) const {
+            uint32_t slot = m_denseToSlot[denseIndex];
+            return EntityHandle(slot, m_slots[slot].version);
+        }
+
+        size_t Size() const { return m_values.size(); }
+        bool Empty() const { return m_values.empty(); }
+
+        void Reserve(size_t count) {
+            m_values.reserve(count);
+            m_denseToSlot.reserve(count);
+            m_slots.reserve(count + 1);
+        }
+
+        /// Destroy all values. Slot versions are bumped so outstanding handles go stale.
+        void Clear() {
+            m_values.clear();
+            m_denseToSlot.clear();
+            m_freeSlots.clear();
+            for (uint32_t slot = static_cast<uint32_t>(m_slots.size()) - 1; slot >= 1; --slot) {
+                if (m_slots[slot].dense != NPOS) {
+                    m_slots[slot].dense = NPOS;
+                    m_slots[slot].version++;
+                }
+                m_freeSlots.push_back(slot);
+            }
+        }
+
+        /// Dense value array, in slot-map order (changes on Remove).
+        std::vector<T>& GetValues() { return m_values; }
+        const std::vector<T>& GetValues() const { return m_values; }
+
+        static constexpr uint32_t NPOS = UINT32_MAX;
+
+    private:
+        struct Slot {
+            uint32_t version = 0;
+            uint32_t dense = NPOS;  // Index into m_values, NPOS when free
+        };
+
+        std::vector<Slot> m_slots = std::vector<Slot>(1);  // Slot 0 reserved (INVALID_ENTITY)
+        std::vector<T> m_values;
+        std::vector<uint32_t> m_denseToSlot;
+        std::vector<uint32_t> m_freeSlots;
+    };
+
+    /// Maps sparse, monotonically growing uint32 ids (e.g. Engine::Entity::GetId)
+    /// to EntityHandles without hashing. Storage is paged: a page is allocated
+    /// when its first id is set and released when its last id is erased, so
+    /// memory follows live ids rather than the highest id ever issued.
+    class PagedIdMap {
+    public:
+        void Set(uint32_t id, EntityHandle handle) {
+            uint32_t pageIndex = id >> PAGE_BITS;
+            if (pageIndex >= m_pages.size()) {
+                m_pages.resize(static_cast<size_t>(pageIndex) + 1);
+            }
+            auto& page = m_pages[pageIndex];
+            if (!page) {
+                page = std::make_unique<Page>();
+                page->entries.fill(INVALID_HANDLE);
+            }
+            EntityHandle& entry = page->entries[id & PAGE_MASK];
+            if (!entry) ++page->count;
+            entry = handle;
+        }
+
+        EntityHandle Find(uint32_t id) const {
+            uint32_t pageIndex = id >> PAGE_BITS;
+            if (pageIndex >= m_pages.size() || !m_pages[pageIndex]) return INVALID_HANDLE;
+            return m_pages[pageIndex]->entries[id & PAGE_MASK];
+        }
+
+        void Erase(uint32_t id) {
+            uint32_t pageIndex = id >> PAGE_BITS;
+            if (pageIndex >= m_pages.size() || !m_pages[pageIndex]) return;
+            auto& page = m_pages[pageIndex];
+            EntityHandle& entry = page->entries[id & PAGE_MASK];
+            if (!entry) return;
+            entry = INVALID_HANDLE;
+            if (--page->count == 0) {
+                page.reset();
+            }
+        }
+
+        void Clear() { m_pages.clear(); }
+
+    private:
+        static constexpr uint32_t PAGE_BITS = 10;
+        static constexpr uint32_t PAGE_SIZE = 1u << PAGE_BITS;
+        static constexpr uint32_t PAGE_MASK = PAGE_SIZE - 1;
+
+        struct Page {
+            std::array<EntityHandle, PAGE_SIZE> entries;
+            uint32_t count = 0;
+        };
+
+        std::vector<std::unique_ptr<Page>> m_pages;
+    };
+
+} // namespace ECS
+} // namespace Engine
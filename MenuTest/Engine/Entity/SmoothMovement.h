@@ -0,0 +1,54 @@
+#pragma once
+
+namespace Engine {
+
+    // Smooth movement interpolation utility.
+    // Owned by entities that need position interpolation (e.g., Character),
+    // or stored as an ECS component and advanced in bulk by MovementInterpolationSystem.
+    // Writes interpolated position to the provided Transform (single source of truth).
+    struct SmoothMovement {
+        bool isMoving = false;
+        int startX = 0, startY = 0;
+        int targetX = 0, targetY = 0;
+        float moveTime = 0.0f;
+        float moveDuration = 0.3f;
+
+        void Start(int fromX, int fromY, int toX, int toY, float duration = 0.3f) {
+            if (fromX == toX && fromY == toY) return;
+            startX = fromX;
+            startY = fromY;
+            targetX = toX;
+            targetY = toY;
+            moveTime = 0.0f;
+            moveDuration = duration > 0.0f ? duration : 0.3f;
+            isMoving = true;
+        }
+
+        // Returns true while still moving. Updates outX/outY with interpolated position.
+        bool Update(float deltaTime, int& outX, int& outY) {
+            if (!isMoving) return false;
+            moveTime += deltaTime;
+            if (moveTime >= moveDuration) {
+                outX = targetX;
+                outY = targetY;
+                isMoving = false;
+                moveTime = 0.0f;
+                return false; // movement finished
+            }
+            float t = moveTime / moveDuration;
+            outX = static_cast<int>(startX + (targetX - startX) * t);
+            outY = static_cast<int>(startY + (targetY - startY) * t);
+            return true; // still moving
+        }
+
+        void Stop(int& outX, int& outY) {
+            outX = targetX;
+            outY = targetY;
+            isMoving = false;
+            moveTime = 0.0f;
+        }
+
+        float GetProgress() const { return isMoving ? (moveTime / moveDuration) : 1.0f; }
+    };
+
+} // namespace Engine
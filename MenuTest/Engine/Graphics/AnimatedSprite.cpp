@@ -7,9 +7,7 @@ namespace Engine {
     AnimatedSprite::AnimatedSprite(std::shared_ptr<Texture> texture, ILogger* logger)
         : m_texture(texture)
         , m_logger(logger)
-        , m_currentAnimation(-1)
-        , m_currentFrame(0)
-        , m_frameTime(0.0f)
+        , m_playback()
         , m_scale(1.0f)
         , m_flip(SDL_FLIP_NONE) {
     }
@@ -23,10 +21,8 @@ namespace Engine {
         m_animationIndex[animation.name] = index;
         
         // If this is the first animation, set it as current
-        if (m_currentAnimation == -1 && !m_animations.empty()) {
-            m_currentAnimation = 0;
-            m_currentFrame = 0;
-            m_frameTime = 0.0f;
+        if (m_playback.animation == -1 && !m_animations.empty()) {
+            m_playback.Play(0);
         }
         
         if (m_logger) {
@@ -39,10 +35,8 @@ namespace Engine {
         auto it = m_animationIndex.find(name);
         if (it != m_animationIndex.end()) {
             int i = it->second;
-            if (m_currentAnimation != i) {
-                m_currentAnimation = i;
-                m_currentFrame = 0;
-                m_frameTime = 0.0f;
+            if (m_playback.animation != i) {
+                m_playback.Play(i);
                 
                 if (m_logger) {
                     m_logger->Debug("Set animation to '" + name + "'");
@@ -56,35 +50,20 @@ namespace Engine {
         }
     }
     void AnimatedSprite::Update(float deltaTime) {
-        if (m_currentAnimation < 0 || m_currentAnimation >= static_cast<int>(m_animations.size())) {
-            return;
-        }
-
-        const Animation& anim = m_animations[m_currentAnimation];
-        if (anim.frames.empty()) {
-            return;
-        }
-
-        m_frameTime += deltaTime;
-
-        const AnimationFrame& currentFrame = anim.frames[m_currentFrame];
-        if (m_frameTime >= currentFrame.duration) {
-            m_frameTime -= currentFrame.duration;
-            m_currentFrame++;
+        AdvanceAnimation(m_animations, m_playback, deltaTime);
+    }
 
-            // Handle loop/end
-            if (m_currentFrame >= static_cast<int>(anim.frames.size())) {
-                if (anim.loop) {
-                    m_currentFrame = 0;
-                } else {
-                    m_currentFrame = static_cast<int>(anim.frames.size()) - 1;
-                }
-            }
-        }
+    int AnimatedSprite::FindAnimation(const std::string& name) const {
+        auto it = m_animationIndex.find(name);
+        return (it != m_animationIndex.end()) ? it->second : -1;
     }
     
     void AnimatedSprite::Render(IRenderer* renderer, int x, int y) {
-        const AnimationFrame* frame = GetCurrentFrame();
+        Render(renderer, x, y, m_playback);
+    }
+    
+    void AnimatedSprite::Render(IRenderer* renderer, int x, int y, const AnimationPlayback& playback) {
+        const AnimationFrame* frame = GetPlaybackFrame(m_animations, playback);
         if (!frame || !m_texture || !renderer) {
             return;
         }
@@ -108,21 +87,12 @@ namespace Engine {
     }
     
     const AnimationFrame* AnimatedSprite::GetCurrentFrame() const {
-        if (m_currentAnimation < 0 || m_currentAnimation >= static_cast<int>(m_animations.size())) {
-            return nullptr;
-        }
-        
-        const Animation& anim = m_animations[m_currentAnimation];
-        if (m_currentFrame < 0 || m_currentFrame >= static_cast<int>(anim.frames.size())) {
-            return nullptr;
-        }
-        
-        return &anim.frames[m_currentFrame];
+        return GetPlaybackFrame(m_animations, m_playback);
     }
     
     std::string AnimatedSprite::GetCurrentAnimationName() const {
-        if (m_currentAnimation >= 0 && m_currentAnimation < static_cast<int>(m_animations.size())) {
-            return m_animations[m_currentAnimation].name;
+        if (m_playback.animation >= 0 && m_playback.animation < static_cast<int>(m_animations.size())) {
+            return m_animations[m_playback.animation].name;
         }
         return "";
     }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "Sprite.h"
+#include "Animation.h"
+#include "../Entity/SmoothMovement.h"
 #include "../Core/Types.h"
 #include <memory>
 #include <vector>
@@ -11,75 +13,6 @@ namespace Engine {
     
     class ILogger;
     
-    // Represents a single frame in an animation
-    struct AnimationFrame {
-        Rect sourceRect;        // Rectangle in the sprite sheet
-        float duration;         // Duration in seconds
-        
-        AnimationFrame() : sourceRect(), duration(0.1f) {}
-        AnimationFrame(const Rect& rect, float dur = 0.1f) 
-            : sourceRect(rect), duration(dur) {}
-    };
-    
-    // Represents an animation sequence
-    struct Animation {
-        std::string name;
-        std::vector<AnimationFrame> frames;
-        bool loop;
-        
-        Animation() : name(""), loop(true) {}
-        Animation(const std::string& n, bool l = true) 
-            : name(n), loop(l) {}
-    };
-
-    // Smooth movement interpolation utility.
-    // Owned by entities that need position interpolation (e.g., Character).
-    // Writes interpolated position to the provided Transform (single source of truth).
-    struct SmoothMovement {
-        bool isMoving = false;
-        int startX = 0, startY = 0;
-        int targetX = 0, targetY = 0;
-        float moveTime = 0.0f;
-        float moveDuration = 0.3f;
-
-        void Start(int fromX, int fromY, int toX, int toY, float duration = 0.3f) {
-            if (fromX == toX && fromY == toY) return;
-            startX = fromX;
-            startY = fromY;
-            targetX = toX;
-            targetY = toY;
-            moveTime = 0.0f;
-            moveDuration = duration > 0.0f ? duration : 0.3f;
-            isMoving = true;
-        }
-
-        // Returns true while still moving. Updates outX/outY with interpolated position.
-        bool Update(float deltaTime, int& outX, int& outY) {
-            if (!isMoving) return false;
-            moveTime += deltaTime;
-            if (moveTime >= moveDuration) {
-                outX = targetX;
-                outY = targetY;
-                isMoving = false;
-                moveTime = 0.0f;
-                return false; // movement finished
-            }
-            float t = moveTime / moveDuration;
-            outX = static_cast<int>(startX + (targetX - startX) * t);
-            outY = static_cast<int>(startY + (targetY - startY) * t);
-            return true; // still moving
-        }
-
-        void Stop(int& outX, int& outY) {
-            outX = targetX;
-            outY = targetY;
-            isMoving = false;
-            moveTime = 0.0f;
-        }
-
-        float GetProgress() const { return isMoving ? (moveTime / moveDuration) : 1.0f; }
-    };
-    
     // Animated sprite class — handles animation frames only.
     // Does NOT own position. Position is provided at render time by the owning entity's Transform.
     class AnimatedSprite {
@@ -91,11 +24,17 @@ namespace Engine {
         void AddAnimation(const Animation& animation);
         void SetAnimation(const std::string& name);
         void Update(float deltaTime);
+
+        /// Index of a named animation, or -1 if not found.
+        int FindAnimation(const std::string& name) const;
         
         // Rendering — position supplied by caller (from Transform)
         void Render(IRenderer* renderer, int x, int y);
         void Render(IRenderer* renderer, const Rect& destRect);
 
+        /// Render using an external playback cursor (e.g., an ECS AnimationState component).
+        void Render(IRenderer* renderer, int x, int y, const AnimationPlayback& playback);
+
         void SetScale(float scale) { m_scale = scale; }
         float GetScale() const { return m_scale; }
         
@@ -106,6 +45,11 @@ namespace Engine {
         // Current frame info
         const AnimationFrame* GetCurrentFrame() const;
         std::string GetCurrentAnimationName() const;
+
+        // Clip data and playback cursor (for ECS migration of animation state)
+        const std::vector<Animation>& GetAnimations() const { return m_animations; }
+        const AnimationPlayback& GetPlayback() const { return m_playback; }
+        AnimationPlayback& GetPlayback() { return m_playback; }
         
     private:
         std::shared_ptr<Texture> m_texture;
@@ -114,9 +58,7 @@ namespace Engine {
         // Animations
         std::vector<Animation> m_animations;
         std::unordered_map<std::string, int> m_animationIndex; // O(1) name→index lookup
-        int m_currentAnimation;
-        int m_currentFrame;
-        float m_frameTime;
+        AnimationPlayback m_playback;
         
         // Scale and flip
         float m_scale;
@@ -94,3 +94,58 @@ TEST_CASE(AnimatedSprite_AddAnimation_ManyAnimations_O1Lookup) {
 
     return {"AnimatedSprite_AddAnimation_ManyAnimations_O1Lookup", true, ""};
 }
+
+// ======================== Interned Animation ID Tests ========================
+
+TEST_CASE(DirectionalAnimationTable_ResolvesActionAndDirection) {
+    std::vector<Engine::Animation> clips;
+    clips.emplace_back("walk_down");
+    clips.emplace_back("walk_right");
+    clips.emplace_back("walk_up");
+    clips.emplace_back("walk_left");
+    clips.emplace_back("idle");
+
+    Engine::DirectionalAnimationTable table;
+    table.Build(clips);
+
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Walk, Engine::Direction::Down), 0);
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Walk, Engine::Direction::Up), 2);
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Walk, Engine::Direction::Left), 3);
+    // No per-direction idle clips: every direction falls back to "idle"
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Idle, Engine::Direction::Down), 4);
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Idle, Engine::Direction::Right), 4);
+    return {"DirectionalAnimationTable_ResolvesActionAndDirection", true, ""};
+}
+
+TEST_CASE(DirectionalAnimationTable_MissingClips_AreInvalid) {
+    std::vector<Engine::Animation> clips;
+    clips.emplace_back("walk_down");
+    clips.emplace_back("idle_up");
+
+    Engine::DirectionalAnimationTable table;
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Walk, Engine::Direction::Down), Engine::INVALID_ANIMATION);
+
+    table.Build(clips);
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Walk, Engine::Direction::Down), 0);
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Walk, Engine::Direction::Up), Engine::INVALID_ANIMATION);
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Idle, Engine::Direction::Up), 1);
+    ASSERT_EQUAL(table.Get(Engine::AnimationAction::Idle, Engine::Direction::Down), Engine::INVALID_ANIMATION);
+    return {"DirectionalAnimationTable_MissingClips_AreInvalid", true, ""};
+}
+
+TEST_CASE(AnimatedSprite_PlaybackById_MatchesNameLookup) {
+    Engine::AnimatedSprite sprite(nullptr, nullptr);
+    Engine::Animation walk("walk_right", true);
+    walk.frames.push_back(Engine::AnimationFrame(Engine::Rect(0, 0, 32, 32), 0.1f));
+    sprite.AddAnimation(Engine::Animation("idle", true));
+    sprite.AddAnimation(walk);
+
+    Engine::DirectionalAnimationTable table;
+    table.Build(sprite.GetAnimations());
+    Engine::AnimationId id = table.Get(Engine::AnimationAction::Walk, Engine::Direction::Right);
+    ASSERT_EQUAL(id, sprite.FindAnimation("walk_right"));
+
+    sprite.GetPlayback().Play(id);
+    ASSERT_STRING_EQUAL(sprite.GetCurrentAnimationName(), "walk_right");
+    return {"AnimatedSprite_PlaybackById_MatchesNameLookup", true, ""};
+}
@@ -0,0 +1,152 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include <vector>
+#include <string>
+#include <array>
+#include <cstdint>
+
+namespace Engine {
+
+    // Represents a single frame in an animation
+    struct AnimationFrame {
+        Rect sourceRect;        // Rectangle in the sprite sheet
+        float duration;         // Duration in seconds
+        
+        AnimationFrame() : sourceRect(), duration(0.1f) {}
+        AnimationFrame(const Rect& rect, float dur = 0.1f) 
+            : sourceRect(rect), duration(dur) {}
+    };
+    
+    // Represents an animation sequence
+    struct Animation {
+        std::string name;
+        std::vector<AnimationFrame> frames;
+        bool loop;
+        
+        Animation() : name(""), loop(true) {}
+        Animation(const std::string& n, bool l = true) 
+            : name(n), loop(l) {}
+    };
+
+    // Playback cursor into a set of animations (current clip, frame and accumulated time).
+    // Kept separate from the clip data so it can live in an AnimatedSprite or in an
+    // ECS component that is advanced in bulk by AnimationSystem.
+    struct AnimationPlayback {
+        int animation = -1;     // Index into the clip set, -1 = none
+        int frame = 0;
+        float frameTime = 0.0f;
+
+        void Play(int index) {
+            if (animation == index) return;
+            animation = index;
+            frame = 0;
+            frameTime = 0.0f;
+        }
+    };
+
+    // Advance playback by deltaTime through the given clip set.
+    inline void AdvanceAnimation(const std::vector<Animation>& animations,
+                                 AnimationPlayback& playback, float deltaTime) {
+        if (playback.animation < 0 || playback.animation >= static_cast<int>(animations.size())) {
+            return;
+        }
+
+        const Animation& anim = animations[playback.animation];
+        if (anim.frames.empty()) {
+            return;
+        }
+
+        playback.frameTime += deltaTime;
+
+        const AnimationFrame& currentFrame = anim.frames[playback.frame];
+        if (playback.frameTime >= currentFrame.duration) {
+            playback.frameTime -= currentFrame.duration;
+            playback.frame++;
+
+            // Handle loop/end
+            if (playback.frame >= static_cast<int>(anim.frames.size())) {
+                if (anim.loop) {
+                    playback.frame = 0;
+                } else {
+                    playback.frame = static_cast<int>(anim.frames.size()) - 1;
+                }
+            }
+        }
+    }
+
+    // Resolve the frame a playback cursor points at, or nullptr if out of range.
+    inline const AnimationFrame* GetPlaybackFrame(const std::vector<Animation>& animations,
+                                                  const AnimationPlayback& playback) {
+        if (playback.animation < 0 || playback.animation >= static_cast<int>(animations.size())) {
+            return nullptr;
+        }
+
+        const Animation& anim = animations[playback.animation];
+        if (playback.frame < 0 || playback.frame >= static_cast<int>(anim.frames.size())) {
+            return nullptr;
+        }
+
+        return &anim.frames[playback.frame];
+    }
+
+    /// Index of an animation within a clip set; -1 means none.
+    using AnimationId = int;
+    constexpr AnimationId INVALID_ANIMATION = -1;
+
+    /// Directional animation actions. Clip names follow "<action>_<direction>",
+    /// e.g. "walk_down" (see DirectionUtil::ToAnimationName).
+    enum class AnimationAction : uint8_t {
+        Idle = 0,
+        Walk = 1,
+        Count
+    };
+
+    inline const char* AnimationActionToString(AnimationAction action) {
+        constexpr const char* names[] = { "idle", "walk" };
+        auto idx = static_cast<uint8_t>(action);
+        return idx < static_cast<uint8_t>(AnimationAction::Count) ? names[idx] : "idle";
+    }
+
+    /// Interned (action, direction) → AnimationId table.
+    /// Built once from a clip set so hot-path animation switches are an array
+    /// lookup: no string building, no hashing.
+    class DirectionalAnimationTable {
+    public:
+        DirectionalAnimationTable() { m_ids.fill(INVALID_ANIMATION); }
+
+        /// Resolve every "<action>_<direction>" name against the clip set.
+        /// Actions without per-direction clips fall back to the bare "<action>" clip.
+        void Build(const std::vector<Animation>& animations) {
+            for (uint8_t a = 0; a < ACTION_COUNT; ++a) {
+                const char* action = AnimationActionToString(static_cast<AnimationAction>(a));
+                AnimationId fallback = Find(animations, action);
+                for (uint8_t d = 0; d < DIRECTION_COUNT; ++d) {
+                    AnimationId id = Find(animations, DirectionUtil::ToAnimationName(static_cast<Direction>(d), action));
+                    m_ids[a * DIRECTION_COUNT + d] = (id != INVALID_ANIMATION) ? id : fallback;
+                }
+            }
+        }
+
+        AnimationId Get(AnimationAction action, Direction dir) const {
+            auto a = static_cast<uint8_t>(action);
+            auto d = static_cast<uint8_t>(dir);
+            if (a >= ACTION_COUNT || d >= DIRECTION_COUNT) return INVALID_ANIMATION;
+            return m_ids[a * DIRECTION_COUNT + d];
+        }
+
+    private:
+        static AnimationId Find(const std::vector<Animation>& animations, const std::string& name) {
+            for (size_t i = 0; i < animations.size(); ++i) {
+                if (animations[i].name == name) return static_cast<AnimationId>(i);
+            }
+            return INVALID_ANIMATION;
+        }
+
+        static constexpr uint8_t ACTION_COUNT = static_cast<uint8_t>(AnimationAction::Count);
+        static constexpr uint8_t DIRECTION_COUNT = 4;
+
+        std::array<AnimationId, ACTION_COUNT * DIRECTION_COUNT> m_ids;
+    };
+
+} // namespace Engine
@@ -0,0 +1,71 @@
+#include "RectPacker.h"
+#include <algorithm>
+#include <numeric>
+
+namespace Engine {
+
+    RectPacker::RectPacker(int pageWidth, int pageHeight, int padding)
+        : m_pageWidth(pageWidth)
+        , m_pageHeight(pageHeight)
+        , m_padding(padding > 0 ? padding : 0) {
+    }
+
+    RectPacker::Placement RectPacker::Insert(int width, int height) {
+        Placement placement;
+        int w = width + m_padding;
+        int h = height + m_padding;
+        if (width <= 0 || height <= 0 || w > m_pageWidth || h > m_pageHeight) return placement;
+
+        // Best existing shelf: fits, wastes the least height
+        Shelf* best = nullptr;
+        for (Shelf& shelf : m_shelves) {
+            if (shelf.height < h || shelf.cursorX + w > m_pageWidth) continue;
+            if (!best || shelf.height < best->height) best = &shelf;
+        }
+
+        if (!best) {
+            if (m_pageCount == 0 || m_nextShelfY + h > m_pageHeight) {
+                ++m_pageCount;
+                m_nextShelfY = 0;
+            }
+            m_shelves.push_back(Shelf{ m_pageCount - 1, m_nextShelfY, h, 0 });
+            m_nextShelfY += h;
+            best = &m_shelves.back();
+        }
+
+        placement.page = best->page;
+        placement.x = best->cursorX;
+        placement.y = best->y;
+        best->cursorX += w;
+        return placement;
+    }
+
+    std::vector<RectPacker::Placement> RectPacker::Pack(const std::vector<Size>& sizes) {
+        std::vector<size_t> order(sizes.size());
+        std::iota(order.begin(), order.end(), size_t{ 0 });
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) {
+            return sizes[a].height > sizes[b].height;
+        });
+
+        std::vector<Placement> placements(sizes.size());
+        for (size_t i : order) {
+            placements[i] = Insert(sizes[i].width, sizes[i].height);
+        }
+        return placements;
+    }
+
+    void RectPacker::Reset() {
+        m_pageCount = 0;
+        m_nextShelfY = 0;
+        m_shelves.clear();
+    }
+
+    int RectPacker::GetUsedHeight(int page) const {
+        int used = 0;
+        for (const Shelf& shelf : m_shelves) {
+            if (shelf.page == page) used = std::max(used, shelf.y + shelf.height);
+        }
+        return used;
+    }
+
+} // namespace Engine
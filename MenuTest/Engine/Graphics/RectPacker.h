@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+namespace Engine {
+
+    /// Shelf packer over fixed-size pages. Rects are placed left to right on
+    /// horizontal shelves; a rect goes on the lowest-waste shelf it fits,
+    /// otherwise on a new shelf, otherwise on a new page. Pack() sorts by
+    /// height first, which keeps shelves tight for same-sized tile art.
+    /// padding is kept free to the right of and below every rect.
+    class RectPacker {
+    public:
+        struct Placement {
+            int page = -1;  // -1: larger than a page, not placed
+            int x = 0;
+            int y = 0;
+        };
+
+        struct Size {
+            int width;
+            int height;
+        };
+
+        RectPacker(int pageWidth, int pageHeight, int padding = 0);
+
+        /// Place one rect in arrival order.
+        Placement Insert(int width, int height);
+
+        /// Place a batch tallest first; placements come back in input order.
+        std::vector<Placement> Pack(const std::vector<Size>& sizes);
+
+        /// Drop every page and shelf.
+        void Reset();
+
+        int GetPageWidth() const { return m_pageWidth; }
+        int GetPageHeight() const { return m_pageHeight; }
+        int GetPageCount() const { return m_pageCount; }
+
+        /// Height actually used on a page (shelf tops plus heights), for
+        /// trimming the last page.
+        int GetUsedHeight(int page) const;
+
+    private:
+        struct Shelf {
+            int page;
+            int y;
+            int height;
+            int cursorX;
+        };
+
+        int m_pageWidth;
+        int m_pageHeight;
+        int m_padding;
+        int m_pageCount = 0;
+        int m_nextShelfY = 0;  // On the last page
+        std::vector<Shelf> m_shelves;
+    };
+
+} // namespace Engine
@@ -0,0 +1,55 @@
+#include "RenderTargetPool.h"
+#include "../Renderer/IRenderer.h"
+#include <SDL3/SDL.h>
+
+namespace Engine {
+
+    RenderTargetPool::RenderTargetPool(size_t maxFree)
+        : m_maxFree(maxFree) {
+    }
+
+    std::shared_ptr<Texture> RenderTargetPool::Acquire(IRenderer* renderer, int width, int height) {
+        for (size_t i = 0; i < m_free.size(); ++i) {
+            if (m_free[i]->GetWidth() == width && m_free[i]->GetHeight() == height) {
+                std::shared_ptr<Texture> texture = std::move(m_free[i]);
+                m_free[i] = std::move(m_free.back());
+                m_free.pop_back();
+                ++m_hits;
+                return texture;
+            }
+        }
+
+        ++m_misses;
+        if (!renderer || width <= 0 || height <= 0) return nullptr;
+        SDL_Renderer* sdlRenderer = renderer->GetNativeRenderer();
+        if (!sdlRenderer) return nullptr;
+
+        SDL_Texture* target = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_RGBA8888,
+                                                SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!target) return nullptr;
+        SDL_SetTextureBlendMode(target, SDL_BLENDMODE_BLEND);
+        return Texture::CreateFromSDL(target, width, height);
+    }
+
+    void RenderTargetPool::Release(std::shared_ptr<Texture> texture) {
+        if (!texture || m_free.size() >= m_maxFree) return;
+        m_free.push_back(std::move(texture));
+    }
+
+    void RenderTargetPool::Clear() {
+        m_free.clear();
+    }
+
+    void RenderTargetPool::SetMaxFree(size_t maxFree) {
+        m_maxFree = maxFree;
+        if (m_free.size() > m_maxFree) {
+            m_free.resize(m_maxFree);
+        }
+    }
+
+    float RenderTargetPool::GetHitRate() const {
+        size_t total = m_hits + m_misses;
+        return total > 0 ? static_cast<float>(m_hits) / static_cast<float>(total) : 0.0f;
+    }
+
+} // namespace Engine
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Texture.h"
+#include <memory>
+#include <vector>
+#include <cstddef>
+
+namespace Engine {
+
+    class IRenderer;
+
+    /// Free list of render-target textures, matched by exact size.
+    /// Acquire hands back a released texture of the same size when there is
+    /// one (a hit) and only creates a new SDL texture on a miss. Released
+    /// textures beyond maxFree are destroyed.
+    class RenderTargetPool {
+    public:
+        explicit RenderTargetPool(size_t maxFree = 64);
+
+        /// A blend-enabled RGBA8888 render target of width x height, or nullptr.
+        std::shared_ptr<Texture> Acquire(IRenderer* renderer, int width, int height);
+
+        /// Return a texture for reuse. Contents are left as they are.
+        void Release(std::shared_ptr<Texture> texture);
+
+        /// Destroy every pooled texture. Stats are kept.
+        void Clear();
+
+        void SetMaxFree(size_t maxFree);
+        size_t GetFreeCount() const { return m_free.size(); }
+        size_t GetHits() const { return m_hits; }
+        size_t GetMisses() const { return m_misses; }
+
+        /// Hits / (hits + misses); 0 before the first Acquire.
+        float GetHitRate() const;
+
+    private:
+        size_t m_maxFree;
+        std::vector<std::shared_ptr<Texture>> m_free;
+        size_t m_hits = 0;
+        size_t m_misses = 0;
+    };
+
+} // namespace Engine
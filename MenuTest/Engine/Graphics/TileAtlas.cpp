@@ -0,0 +1,166 @@
+#include "TileAtlas.h"
+#include "../Renderer/IRenderer.h"
+#include "../Core/Logger/ILogger.h"
+#include <SDL3/SDL.h>
+#include <SDL3_image/SDL_image.h>
+#include <algorithm>
+
+namespace Engine {
+
+    namespace {
+        void DestroySurfaces(std::vector<SDL_Surface*>& surfaces) {
+            for (SDL_Surface* surface : surfaces) {
+                if (surface) SDL_DestroySurface(surface);
+            }
+            surfaces.clear();
+        }
+
+        // Copy src into dst at rect, then repeat its outermost rows and
+        // columns into the border around it
+        void BlitExtruded(SDL_Surface* src, SDL_Surface* dst, const Rect& rect) {
+            int w = rect.w;
+            int h = rect.h;
+            SDL_Rect whole{ 0, 0, w, h };
+            SDL_Rect at{ rect.x, rect.y, w, h };
+            SDL_BlitSurface(src, &whole, dst, &at);
+
+            for (int e = 1; e <= TileAtlas::EXTRUDE; ++e) {
+                SDL_Rect top{ 0, 0, w, 1 };
+                SDL_Rect topAt{ rect.x, rect.y - e, w, 1 };
+                SDL_Rect bottom{ 0, h - 1, w, 1 };
+                SDL_Rect bottomAt{ rect.x, rect.y + h - 1 + e, w, 1 };
+                SDL_Rect left{ 0, 0, 1, h };
+                SDL_Rect leftAt{ rect.x - e, rect.y, 1, h };
+                SDL_Rect right{ w - 1, 0, 1, h };
+                SDL_Rect rightAt{ rect.x + w - 1 + e, rect.y, 1, h };
+                SDL_BlitSurface(src, &top, dst, &topAt);
+                SDL_BlitSurface(src, &bottom, dst, &bottomAt);
+                SDL_BlitSurface(src, &left, dst, &leftAt);
+                SDL_BlitSurface(src, &right, dst, &rightAt);
+            }
+        }
+    }
+
+    TileAtlas::TileAtlas(ILogger* logger)
+        : m_logger(logger) {
+    }
+
+    Result<void> TileAtlas::Build(IRenderer* renderer, const std::vector<Source>& sources, int pageSize) {
+        Clear();
+        if (!renderer || !renderer->GetNativeRenderer()) {
+            return Result<void>::Failure("TileAtlas: renderer is null");
+        }
+        SDL_Renderer* sdlRenderer = renderer->GetNativeRenderer();
+
+        std::vector<SDL_Surface*> images;
+        std::vector<uint16_t> ids;
+        std::vector<RectPacker::Size> sizes;
+        images.reserve(sources.size());
+        for (const Source& source : sources) {
+            SDL_Surface* image = IMG_Load(source.path.c_str());
+            if (!image) {
+                DestroySurfaces(images);
+                return Result<void>::Failure("TileAtlas: failed to load " + source.path + " - " + SDL_GetError());
+            }
+            // Copy pixels as they are, alpha included
+            SDL_SetSurfaceBlendMode(image, SDL_BLENDMODE_NONE);
+            images.push_back(image);
+            ids.push_back(source.tileId);
+            sizes.push_back(RectPacker::Size{ image->w, image->h });
+        }
+
+        if (!Layout(ids, sizes, pageSize)) {
+            DestroySurfaces(images);
+            Clear();
+            return Result<void>::Failure("TileAtlas: a tile image is larger than a page");
+        }
+
+        for (size_t page = 0; page < m_pageSizes.size(); ++page) {
+            SDL_Surface* surface = SDL_CreateSurface(m_pageSizes[page].width, m_pageSizes[page].height,
+                                                     SDL_PIXELFORMAT_RGBA8888);
+            if (!surface) {
+                DestroySurfaces(images);
+                Clear();
+                return Result<void>::Failure(std::string("TileAtlas: failed to create page surface - ") + SDL_GetError());
+            }
+
+            for (size_t i = 0; i < images.size(); ++i) {
+                const Entry& entry = m_entries[ids[i]];
+                if (entry.page == static_cast<int>(page)) {
+                    BlitExtruded(images[i], surface, entry.rect);
+                }
+            }
+
+            SDL_Texture* texture = SDL_CreateTextureFromSurface(sdlRenderer, surface);
+            int width = surface->w;
+            int height = surface->h;
+            SDL_DestroySurface(surface);
+            if (!texture) {
+                DestroySurfaces(images);
+                Clear();
+                return Result<void>::Failure(std::string("TileAtlas: failed to create page texture - ") + SDL_GetError());
+            }
+            SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+            m_pages.push_back(Texture::CreateFromSDL(texture, width, height));
+        }
+
+        DestroySurfaces(images);
+        if (m_logger) {
+            m_logger->Info("TileAtlas: packed " + std::to_string(m_entryCount) + " tile images into " +
+                           std::to_string(m_pages.size()) + " page(s)");
+        }
+        return Result<void>::Success();
+    }
+
+    bool TileAtlas::Layout(const std::vector<uint16_t>& tileIds, const std::vector<RectPacker::Size>& sizes,
+                           int pageSize) {
+        Clear();
+        size_t count = std::min(tileIds.size(), sizes.size());
+
+        // Each slot holds the sprite plus its extruded border
+        std::vector<RectPacker::Size> slots(count);
+        uint16_t maxId = 0;
+        for (size_t i = 0; i < count; ++i) {
+            slots[i] = RectPacker::Size{ sizes[i].width + 2 * EXTRUDE, sizes[i].height + 2 * EXTRUDE };
+            maxId = std::max(maxId, tileIds[i]);
+        }
+
+        RectPacker packer(pageSize, pageSize);
+        std::vector<RectPacker::Placement> placements = packer.Pack(slots);
+        for (const RectPacker::Placement& placement : placements) {
+            if (placement.page < 0) {
+                Clear();
+                return false;
+            }
+        }
+
+        // Trim each page to the height its shelves use
+        m_pageSizes.resize(static_cast<size_t>(packer.GetPageCount()));
+        for (int page = 0; page < packer.GetPageCount(); ++page) {
+            m_pageSizes[page] = RectPacker::Size{ pageSize, packer.GetUsedHeight(page) };
+        }
+
+        if (count > 0) m_entries.resize(static_cast<size_t>(maxId) + 1);
+        for (size_t i = 0; i < count; ++i) {
+            Entry& entry = m_entries[tileIds[i]];
+            if (entry.page < 0) ++m_entryCount;
+
+            const RectPacker::Size& page = m_pageSizes[placements[i].page];
+            entry.page = placements[i].page;
+            entry.rect = Rect(placements[i].x + EXTRUDE, placements[i].y + EXTRUDE, sizes[i].width, sizes[i].height);
+            entry.uvMin = SDL_FPoint{ static_cast<float>(entry.rect.x) / page.width,
+                                      static_cast<float>(entry.rect.y) / page.height };
+            entry.uvMax = SDL_FPoint{ static_cast<float>(entry.rect.x + entry.rect.w) / page.width,
+                                      static_cast<float>(entry.rect.y + entry.rect.h) / page.height };
+        }
+        return true;
+    }
+
+    void TileAtlas::Clear() {
+        m_entries.clear();
+        m_entryCount = 0;
+        m_pageSizes.clear();
+        m_pages.clear();
+    }
+
+} // namespace Engine
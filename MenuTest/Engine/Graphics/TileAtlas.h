@@ -0,0 +1,79 @@
+#pragma once
+
+#include "../Core/Types.h"
+#include "RectPacker.h"
+#include "Texture.h"
+#include <SDL3/SDL.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Engine {
+
+    class IRenderer;
+    class ILogger;
+
+    /// Tile art packed into a few large textures, looked up by tile id.
+    /// Build() loads one PNG per tile id at load time, packs them with
+    /// RectPacker and uploads one texture per page, so a chunk bake binds
+    /// a page once instead of a texture per tile type. Each sprite gets a
+    /// one-pixel border copied from its own edge pixels, so filtered
+    /// sampling at the sprite edge does not bleed in its neighbours.
+    class TileAtlas {
+    public:
+        static constexpr int DEFAULT_PAGE_SIZE = 1024;
+        static constexpr int EXTRUDE = 1;  // Border pixels around each sprite
+
+        struct Source {
+            uint16_t tileId;
+            std::string path;
+        };
+
+        /// Where a tile id's art lives: page, pixel rect and normalized UVs.
+        struct Entry {
+            int page = -1;  // -1: id has no art
+            Rect rect;
+            SDL_FPoint uvMin{ 0.0f, 0.0f };
+            SDL_FPoint uvMax{ 0.0f, 0.0f };
+        };
+
+        explicit TileAtlas(ILogger* logger = nullptr);
+
+        /// Load, pack and upload every source. Replaces any previous atlas.
+        /// Fails if an image cannot be loaded or is larger than a page.
+        Result<void> Build(IRenderer* renderer, const std::vector<Source>& sources,
+                           int pageSize = DEFAULT_PAGE_SIZE);
+
+        /// Pack sprites of the given sizes and fill in the entries, without
+        /// touching SDL. Build() does this between loading and uploading.
+        /// Returns false if a sprite does not fit on a page.
+        bool Layout(const std::vector<uint16_t>& tileIds, const std::vector<RectPacker::Size>& sizes,
+                    int pageSize = DEFAULT_PAGE_SIZE);
+
+        /// Art for a tile id, or nullptr.
+        const Entry* Find(uint16_t tileId) const {
+            if (tileId >= m_entries.size() || m_entries[tileId].page < 0) return nullptr;
+            return &m_entries[tileId];
+        }
+
+        void Clear();
+
+        size_t GetEntryCount() const { return m_entryCount; }
+        size_t GetPageCount() const { return m_pageSizes.size(); }
+        RectPacker::Size GetPageSize(int page) const { return m_pageSizes[page]; }
+
+        /// Page texture, or nullptr before Build() (or after Layout() alone).
+        SDL_Texture* GetPageTexture(int page) const {
+            if (page < 0 || static_cast<size_t>(page) >= m_pages.size() || !m_pages[page]) return nullptr;
+            return m_pages[page]->GetSDLTexture();
+        }
+
+    private:
+        ILogger* m_logger;
+        std::vector<Entry> m_entries;  // Indexed by tile id
+        size_t m_entryCount = 0;
+        std::vector<RectPacker::Size> m_pageSizes;
+        std::vector<std::shared_ptr<Texture>> m_pages;
+    };
+
+} // namespace Engine
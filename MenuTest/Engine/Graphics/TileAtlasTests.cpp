@@ -0,0 +1,80 @@
+#include "../../Tests/SimpleTest.h"
+#include "RectPacker.h"
+#include "TileAtlas.h"
+
+using namespace Engine;
+using namespace SimpleTest;
+
+TEST_CASE(RectPacker_Pack_NoOverlapAndNewPageWhenFull) {
+    // 100x50 tile art (plus padding) on 256x128 pages: 2 per shelf, 2 shelves
+    RectPacker packer(256, 128, 2);
+    std::vector<RectPacker::Size> sizes(9, RectPacker::Size{ 100, 50 });
+    sizes[4] = RectPacker::Size{ 40, 20 };
+    std::vector<RectPacker::Placement> placed = packer.Pack(sizes);
+    ASSERT_EQUAL(placed.size(), sizes.size());
+
+    bool inside = true;
+    bool overlap = false;
+    for (size_t i = 0; i < placed.size(); ++i) {
+        inside = inside && placed[i].page >= 0
+            && placed[i].x + sizes[i].width <= 256 && placed[i].y + sizes[i].height <= 128;
+        for (size_t j = i + 1; j < placed.size(); ++j) {
+            if (placed[i].page != placed[j].page) continue;
+            bool apart = placed[i].x + sizes[i].width + 2 <= placed[j].x
+                || placed[j].x + sizes[j].width + 2 <= placed[i].x
+                || placed[i].y + sizes[i].height + 2 <= placed[j].y
+                || placed[j].y + sizes[j].height + 2 <= placed[i].y;
+            overlap = overlap || !apart;
+        }
+    }
+    ASSERT_TRUE(inside);
+    ASSERT_FALSE(overlap);
+    ASSERT_EQUAL(packer.GetPageCount(), 2);
+
+    ASSERT_EQUAL(packer.GetUsedHeight(1), 104);
+
+    // Packed last (shortest), the small rect fills the gap on the first shelf
+    ASSERT_EQUAL(placed[4].page, 0);
+    ASSERT_EQUAL(placed[4].x, 204);
+    ASSERT_EQUAL(placed[4].y, 0);
+
+    ASSERT_EQUAL(packer.Insert(300, 10).page, -1);
+    packer.Reset();
+    ASSERT_EQUAL(packer.GetPageCount(), 0);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileAtlas_Layout_MapsIdsToExtrudedRects) {
+    TileAtlas atlas;
+    std::vector<uint16_t> ids{ 7, 0, 3 };
+    std::vector<RectPacker::Size> sizes{ { 100, 50 }, { 100, 50 }, { 64, 100 } };
+    ASSERT_TRUE(atlas.Layout(ids, sizes, 256));
+    ASSERT_EQUAL(atlas.GetEntryCount(), (size_t)3);
+    ASSERT_EQUAL(atlas.GetPageCount(), (size_t)1);
+    ASSERT_NULL(atlas.Find(1));
+    ASSERT_NULL(atlas.Find(500));
+
+    const TileAtlas::Entry* tall = atlas.Find(3);
+    ASSERT_NOT_NULL(tall);
+    // Tallest first: top-left slot, sprite inset by the extruded border
+    ASSERT_EQUAL(tall->rect.x, TileAtlas::EXTRUDE);
+    ASSERT_EQUAL(tall->rect.y, TileAtlas::EXTRUDE);
+    ASSERT_EQUAL(tall->rect.w, 64);
+    ASSERT_EQUAL(tall->rect.h, 100);
+
+    // Page trimmed to the used height; UVs normalized to it
+    RectPacker::Size page = atlas.GetPageSize(0);
+    ASSERT_EQUAL(page.width, 256);
+    ASSERT_EQUAL(page.height, 154);  // Tall shelf (102) + one ground shelf (52)
+    const TileAtlas::Entry* ground = atlas.Find(7);
+    ASSERT_NOT_NULL(ground);
+    ASSERT_FLOAT_NEAR(ground->uvMin.x, (float)ground->rect.x / 256.0f, 0.0001f);
+    ASSERT_FLOAT_NEAR(ground->uvMax.y, (float)(ground->rect.y + 50) / 154.0f, 0.0001f);
+    ASSERT_NULL(atlas.GetPageTexture(0));  // Layout alone uploads nothing
+
+    // A sprite larger than a page fails and leaves the atlas empty
+    ASSERT_FALSE(atlas.Layout({ 1 }, { { 300, 20 } }, 256));
+    ASSERT_EQUAL(atlas.GetEntryCount(), (size_t)0);
+    ASSERT_FALSE(atlas.Build(nullptr, {}));
+    return TestResult{__FUNCTION__, true, ""};
+}
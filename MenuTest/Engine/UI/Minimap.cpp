@@ -4,7 +4,9 @@
 #include "../World/TileMap.h"
 #include "../Entity/Entity.h"
 #include "../Core/Logger/ILogger.h"
+#include "../../Game/World/Systems/VisionSystem.h"
 #include <SDL3/SDL.h>
+#include <algorithm>
 
 namespace Engine {
 
@@ -20,6 +22,103 @@ namespace Engine {
 
     Minimap::~Minimap() = default;
 
+    namespace {
+        // RGBA8888 fog pixels: black with the same alphas as FogOfWarRenderer
+        const uint32_t FOG_PIXEL_VISIBLE = 0x00000000u;
+        const uint32_t FOG_PIXEL_EXPLORED = 0x0000008Cu;
+        const uint32_t FOG_PIXEL_UNEXPLORED = 0x000000FFu;
+    }
+
+    namespace {
+        // One block spanning tiles [colBegin, colEnd) of a row
+        void DrawTileRun(SDL_Renderer* sdl, bool walkable, uint16_t row, uint16_t colBegin, uint16_t colEnd,
+                         float scaleX, float scaleY) {
+            if (walkable) {
+                SDL_SetRenderDrawColor(sdl, 60, 80, 60, 255); // Ground
+            } else {
+                SDL_SetRenderDrawColor(sdl, 120, 80, 40, 255); // Wall
+            }
+
+            SDL_FRect r;
+            r.x = colBegin * scaleX;
+            r.y = row * scaleY;
+            r.w = (colEnd - colBegin) * scaleX + 1;
+            r.h = scaleY + 1;
+            SDL_RenderFillRect(sdl, &r);
+        }
+    }
+
+    bool Minimap::EnsureFogTexture(IRenderer* renderer, uint16_t tilesWide, uint16_t tilesHigh) {
+        if (m_fogTexture && m_fogWidth == tilesWide && m_fogHeight == tilesHigh) return true;
+        if (!renderer || tilesWide == 0 || tilesHigh == 0) return false;
+
+        SDL_Renderer* sdl = renderer->GetNativeRenderer();
+        if (!sdl) return false;
+
+        SDL_Texture* tex = SDL_CreateTexture(sdl, SDL_PIXELFORMAT_RGBA8888,
+                                              SDL_TEXTUREACCESS_STREAMING, tilesWide, tilesHigh);
+        if (!tex) return false;
+        SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_NEAREST);
+
+        m_fogTexture = Texture::CreateFromSDL(tex, tilesWide, tilesHigh);
+        m_fogWidth = tilesWide;
+        m_fogHeight = tilesHigh;
+        m_fogPixels.assign(static_cast<size_t>(tilesWide) * tilesHigh, FOG_PIXEL_UNEXPLORED);
+        return true;
+    }
+
+    void Minimap::UploadFogRows(int firstRow, int lastRow) {
+        if (!m_fogTexture || firstRow > lastRow) {
+            m_lastFogUploadPixels = 0;
+            return;
+        }
+        SDL_Rect rect{0, firstRow, m_fogWidth, lastRow - firstRow + 1};
+        SDL_UpdateTexture(m_fogTexture->GetSDLTexture(), &rect,
+                          &m_fogPixels[static_cast<size_t>(firstRow) * m_fogWidth],
+                          static_cast<int>(m_fogWidth * sizeof(uint32_t)));
+        m_lastFogUploadPixels = static_cast<size_t>(rect.w) * rect.h;
+    }
+
+    void Minimap::SyncVisibility(IRenderer* renderer, const LegalCrime::World::VisionSystem& vision) {
+        if (!EnsureFogTexture(renderer, vision.GetWidth(), vision.GetHeight())) return;
+
+        for (uint16_t row = 0; row < m_fogHeight; ++row) {
+            for (uint16_t col = 0; col < m_fogWidth; ++col) {
+                auto vis = vision.GetVisibility(row, col);
+                m_fogPixels[static_cast<size_t>(row) * m_fogWidth + col] =
+                    (vis == LegalCrime::World::TileVisibility::Visible) ? FOG_PIXEL_VISIBLE :
+                    (vis == LegalCrime::World::TileVisibility::Explored) ? FOG_PIXEL_EXPLORED :
+                    FOG_PIXEL_UNEXPLORED;
+            }
+        }
+        UploadFogRows(0, m_fogHeight - 1);
+    }
+
+    void Minimap::ApplyVisibilityChanges(IRenderer* renderer, const LegalCrime::World::VisionSystem& vision,
+                                         const LegalCrime::World::VisibilityChanges& changes) {
+        if (!m_fogTexture || m_fogWidth != vision.GetWidth() || m_fogHeight != vision.GetHeight()) {
+            SyncVisibility(renderer, vision);
+            return;
+        }
+
+        // One upload covering the changed rows; fog changes cluster around units
+        int firstRow = m_fogHeight;
+        int lastRow = -1;
+        auto write = [&](const std::vector<TilePosition>& tiles, uint32_t pixel) {
+            for (const TilePosition& tile : tiles) {
+                if (tile.row >= m_fogHeight || tile.col >= m_fogWidth) continue;
+                m_fogPixels[static_cast<size_t>(tile.row) * m_fogWidth + tile.col] = pixel;
+                firstRow = std::min(firstRow, static_cast<int>(tile.row));
+                lastRow = std::max(lastRow, static_cast<int>(tile.row));
+            }
+        };
+        write(changes.becameVisible, FOG_PIXEL_VISIBLE);
+        write(changes.becameHidden, FOG_PIXEL_EXPLORED);
+        write(changes.forgotten, FOG_PIXEL_UNEXPLORED);
+        UploadFogRows(firstRow, lastRow);
+    }
+
     void Minimap::UpdateFromTileMap(IRenderer* renderer, const TileMap& map) {
         if (!renderer) return;
 
@@ -35,35 +134,55 @@ namespace Engine {
         SDL_SetRenderDrawColor(sdl, 20, 20, 20, 255);
         SDL_RenderClear(sdl);
 
-        // Draw each tile as a colored pixel block
-        uint16_t mapW = map.GetWidth();
-        uint16_t mapH = map.GetHeight();
-        float scaleX = static_cast<float>(m_width) / mapW;
-        float scaleY = static_cast<float>(m_height) / mapH;
+        // Draw each row as blocks of same-coloured runs
+        TileMap::TileView tiles = map.GetTileView();
+        float scaleX = static_cast<float>(m_width) / tiles.width;
+        float scaleY = static_cast<float>(m_height) / tiles.height;
 
-        for (uint16_t row = 0; row < mapH; ++row) {
-            for (uint16_t col = 0; col < mapW; ++col) {
-                const Tile* tile = map.GetTile(row, col);
-                if (!tile) continue;
-
-                if (tile->IsWalkable()) {
-                    SDL_SetRenderDrawColor(sdl, 60, 80, 60, 255); // Ground
-                } else {
-                    SDL_SetRenderDrawColor(sdl, 120, 80, 40, 255); // Wall
-                }
-
-                SDL_FRect r;
-                r.x = col * scaleX;
-                r.y = row * scaleY;
-                r.w = scaleX + 1;
-                r.h = scaleY + 1;
-                SDL_RenderFillRect(sdl, &r);
+        for (uint16_t row = 0; row < tiles.height; ++row) {
+            const Tile* line = tiles.Row(row);
+            int runStart = 0;
+            for (int col = 1; col <= tiles.width; ++col) {
+                if (col < tiles.width && line[col].IsWalkable() == line[runStart].IsWalkable()) continue;
+                DrawTileRun(sdl, line[runStart].IsWalkable(), row, static_cast<uint16_t>(runStart),
+                            static_cast<uint16_t>(col), scaleX, scaleY);
+                runStart = col;
             }
         }
 
         SDL_SetRenderTarget(sdl, nullptr);
         m_mapTexture = Texture::CreateFromSDL(tex, m_width, m_height);
         m_dirty = false;
+        m_pendingTiles.clear();
+    }
+
+    void Minimap::InvalidateTile(uint16_t row, uint16_t col) {
+        if (m_dirty) return;
+        if (m_pendingTiles.size() >= MAX_TILE_PATCHES) {
+            // Cheaper to redraw everything than to patch this many blocks
+            m_pendingTiles.clear();
+            m_dirty = true;
+            return;
+        }
+        m_pendingTiles.push_back(TilePosition(row, col));
+    }
+
+    void Minimap::PatchTiles(IRenderer* renderer, const TileMap& map) {
+        SDL_Renderer* sdl = renderer->GetNativeRenderer();
+        if (!sdl || !m_mapTexture) return;
+
+        TileMap::TileView tiles = map.GetTileView();
+        float scaleX = static_cast<float>(m_width) / tiles.width;
+        float scaleY = static_cast<float>(m_height) / tiles.height;
+
+        SDL_SetRenderTarget(sdl, m_mapTexture->GetSDLTexture());
+        for (const TilePosition& pos : m_pendingTiles) {
+            if (pos.row >= tiles.height || pos.col >= tiles.width) continue;
+            DrawTileRun(sdl, tiles.At(pos.row, pos.col).IsWalkable(), pos.row, pos.col,
+                        static_cast<uint16_t>(pos.col + 1), scaleX, scaleY);
+        }
+        SDL_SetRenderTarget(sdl, nullptr);
+        m_pendingTiles.clear();
     }
 
     void Minimap::Render(IRenderer* renderer, const TileMap& map,
@@ -77,6 +196,8 @@ namespace Engine {
         // Re-generate minimap texture if needed
         if (m_dirty || !m_mapTexture) {
             UpdateFromTileMap(renderer, map);
+        } else if (!m_pendingTiles.empty()) {
+            PatchTiles(renderer, map);
         }
 
         // Draw minimap background
@@ -86,6 +207,13 @@ namespace Engine {
             m_mapTexture->Render(renderer, dest, &src);
         }
 
+        // Fog layer, one texel per tile stretched over the map
+        if (m_fogTexture) {
+            Rect dest(m_screenX, m_screenY, m_width, m_height);
+            Rect src(0, 0, m_fogWidth, m_fogHeight);
+            m_fogTexture->Render(renderer, dest, &src);
+        }
+
         // Draw border
         renderer->SetDrawColor(200, 200, 200, 255);
         Point border[5] = {
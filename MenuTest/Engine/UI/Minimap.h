@@ -4,6 +4,14 @@
 #include "../Graphics/Texture.h"
 #include <vector>
 #include <memory>
+#include <cstdint>
+
+namespace LegalCrime {
+namespace World {
+    class VisionSystem;
+    struct VisibilityChanges;
+}
+}
 
 namespace Engine {
 
@@ -16,6 +24,9 @@ namespace Engine {
     /// Minimap widget rendered in a corner of the screen.
     /// Shows a downscaled tilemap, unit dots, and the camera viewport.
     /// Click on the minimap to move the camera.
+    /// An optional fog layer (one pixel per tile, scaled up) darkens
+    /// unexplored and explored tiles; SyncVisibility uploads it whole, then
+    /// ApplyVisibilityChanges uploads only the rows the change set touches.
     class Minimap {
     public:
         Minimap(int width, int height, ILogger* logger = nullptr);
@@ -27,6 +38,15 @@ namespace Engine {
         /// Update the minimap texture from tilemap data. Call when map changes.
         void UpdateFromTileMap(IRenderer* renderer, const TileMap& map);
 
+        /// Queue one tile for redraw on the next Render (TileMap change
+        /// listener). Only that tile's block of the map texture is repainted;
+        /// past MAX_TILE_PATCHES queued tiles the whole texture is rebuilt.
+        void InvalidateTile(uint16_t row, uint16_t col);
+        size_t GetPendingTilePatchCount() const { return m_pendingTiles.size(); }
+        bool IsFullRebuildPending() const { return m_dirty; }
+
+        static constexpr size_t MAX_TILE_PATCHES = 256;
+
         /// Render the minimap with unit dots and viewport rectangle.
         void Render(IRenderer* renderer, const TileMap& map,
                     const std::vector<Entity*>& entities,
@@ -43,6 +63,16 @@ namespace Engine {
 
         void SetUnitDotColor(const Color& color) { m_unitDotColor = color; }
 
+        /// Rebuild the fog layer from the full vision grid.
+        void SyncVisibility(IRenderer* renderer, const LegalCrime::World::VisionSystem& vision);
+
+        /// Patch the fog layer with one tick's changes (VisionSystem::FlushChanges).
+        void ApplyVisibilityChanges(IRenderer* renderer, const LegalCrime::World::VisionSystem& vision,
+                                    const LegalCrime::World::VisibilityChanges& changes);
+
+        /// Fog pixels uploaded by the last Sync / Apply call.
+        size_t GetLastFogUploadPixels() const { return m_lastFogUploadPixels; }
+
     private:
         ILogger* m_logger;
         int m_width;
@@ -51,8 +81,20 @@ namespace Engine {
         int m_screenY;
         bool m_dirty;
 
+        bool EnsureFogTexture(IRenderer* renderer, uint16_t tilesWide, uint16_t tilesHigh);
+        void UploadFogRows(int firstRow, int lastRow);
+        void PatchTiles(IRenderer* renderer, const TileMap& map);
+
         Color m_unitDotColor;
         std::shared_ptr<Texture> m_mapTexture;
+        std::vector<TilePosition> m_pendingTiles;  // Queued by InvalidateTile
+
+        // Fog layer: RGBA8888 per tile, streamed into m_fogTexture
+        std::shared_ptr<Texture> m_fogTexture;
+        std::vector<uint32_t> m_fogPixels;
+        uint16_t m_fogWidth = 0;
+        uint16_t m_fogHeight = 0;
+        size_t m_lastFogUploadPixels = 0;
     };
 
 } // namespace Engine
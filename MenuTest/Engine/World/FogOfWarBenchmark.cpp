@@ -0,0 +1,68 @@
+#include "../../Tests/SimpleTest.h"
+#include "FogOfWarRenderer.h"
+#include "TileMap.h"
+#include "../../Game/World/Systems/VisionSystem.h"
+#include <chrono>
+#include <iostream>
+
+using namespace Engine;
+using namespace SimpleTest;
+
+TEST_CASE(FogBench_GeometryVsTexture_256_Panning) {
+    // 256x256 map, 1920x1080 view; each frame 20 viewers step and the camera
+    // pans, which is the worst case for the cached geometry path
+    const uint16_t mapSize = 256;
+    const int frames = 200;
+    TileMap map(mapSize, mapSize, nullptr);
+    map.Initialize(1920, 1080);
+    Rect screen(0, 0, 1920, 1080);
+
+    LegalCrime::World::VisionSystem vision(mapSize, mapSize);
+    for (uint32_t v = 0; v < 20; ++v) {
+        vision.SetViewer(v, TilePosition(static_cast<uint16_t>(100 + v * 3), 100), 8);
+    }
+    vision.FlushChanges();
+
+    FogOfWarRenderer geometry;
+    geometry.Sync(vision);
+    FogOfWarRenderer texture;
+    texture.Sync(vision);
+    texture.SetMode(FogRenderMode::Texture);
+    int firstRow, lastRow;
+    texture.TakeDirtyRows(firstRow, lastRow);
+
+    long long geometryNs = 0, textureNs = 0;
+    size_t geometryVertices = 0, textureVertices = 0, texelsUploaded = 0;
+    for (int frame = 0; frame < frames; ++frame) {
+        for (uint32_t v = 0; v < 20; ++v) {
+            vision.SetViewer(v, TilePosition(static_cast<uint16_t>(100 + v * 3), static_cast<uint16_t>(100 + frame % 50)), 8);
+        }
+        const auto& changes = vision.FlushChanges();
+        map.SetOffset(-(frame % 40) * 4, (frame % 40) * 2);
+
+        auto start = std::chrono::high_resolution_clock::now();
+        geometry.ApplyChanges(vision, changes);
+        geometry.BuildGeometry(map, screen);
+        auto mid = std::chrono::high_resolution_clock::now();
+        texture.ApplyChanges(vision, changes);
+        texelsUploaded += texture.TakeDirtyRows(firstRow, lastRow);
+        texture.BuildTextureQuad(map, screen);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        geometryNs += std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count();
+        textureNs += std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count();
+        geometryVertices += geometry.GetLastRenderStats().vertices;
+        textureVertices += texture.GetLastRenderStats().vertices;
+    }
+
+    std::cout << "  [bench] Fog 256^2 panning: geometry " << (geometryNs / frames / 1000) << " us/frame, "
+              << (geometryVertices / frames) << " verts; texture " << (textureNs / frames / 1000) << " us/frame, "
+              << (textureVertices / frames) << " verts, " << (texelsUploaded / frames) << " texels uploaded/frame"
+              << std::endl;
+
+    ASSERT_EQUAL(textureVertices / frames, (size_t)4);
+    ASSERT_TRUE(geometryVertices > textureVertices);
+    ASSERT_TRUE(texelsUploaded < (size_t)frames * mapSize * mapSize);
+    ASSERT_TRUE(geometryNs < 10000000000LL);
+    return TestResult{__FUNCTION__, true, ""};
+}
@@ -6,6 +6,8 @@
 #include "../Core/Logger/ILogger.h"
 #include "../../Game/World/Systems/VisionSystem.h"
 #include <SDL3/SDL.h>
+#include <algorithm>
+#include <climits>
 
 namespace Engine {
 
@@ -16,6 +18,229 @@ namespace Engine {
 
     FogOfWarRenderer::~FogOfWarRenderer() = default;
 
+    namespace {
+        const uint8_t FOG_ALPHA_VISIBLE = 0;
+        const uint8_t FOG_ALPHA_EXPLORED = 140;
+        const uint8_t FOG_ALPHA_UNEXPLORED = 255;
+
+        // RGBA8888 texel: black, fog alpha in the low byte
+        uint32_t FogTexel(uint8_t alpha) {
+            return static_cast<uint32_t>(alpha);
+        }
+
+        uint8_t FogAlphaFor(LegalCrime::World::TileVisibility vis) {
+            switch (vis) {
+                case LegalCrime::World::TileVisibility::Visible:  return FOG_ALPHA_VISIBLE;
+                case LegalCrime::World::TileVisibility::Explored: return FOG_ALPHA_EXPLORED;
+                default:                                          return FOG_ALPHA_UNEXPLORED;
+            }
+        }
+    }
+
+    void FogOfWarRenderer::Sync(const LegalCrime::World::VisionSystem& vision) {
+        m_width = vision.GetWidth();
+        m_height = vision.GetHeight();
+        m_fogAlpha.resize(static_cast<size_t>(m_width) * m_height);
+        for (uint16_t row = 0; row < m_height; ++row) {
+            for (uint16_t col = 0; col < m_width; ++col) {
+                m_fogAlpha[static_cast<size_t>(row) * m_width + col] = FogAlphaFor(vision.GetVisibility(row, col));
+            }
+        }
+        m_lastUpdatedTiles = m_fogAlpha.size();
+        m_geometryDirty = true;
+        if (m_mode == FogRenderMode::Texture) {
+            RebuildTexels();
+        }
+    }
+
+    void FogOfWarRenderer::ApplyChanges(const LegalCrime::World::VisionSystem& vision,
+                                        const LegalCrime::World::VisibilityChanges& changes) {
+        if (m_width != vision.GetWidth() || m_height != vision.GetHeight() || m_fogAlpha.empty()) {
+            Sync(vision);
+            return;
+        }
+        for (const TilePosition& tile : changes.becameVisible) SetTileAlpha(tile, FOG_ALPHA_VISIBLE);
+        for (const TilePosition& tile : changes.becameHidden)  SetTileAlpha(tile, FOG_ALPHA_EXPLORED);
+        for (const TilePosition& tile : changes.forgotten)     SetTileAlpha(tile, FOG_ALPHA_UNEXPLORED);
+        m_lastUpdatedTiles = changes.becameVisible.size() + changes.becameHidden.size() + changes.forgotten.size();
+    }
+
+    uint8_t FogOfWarRenderer::GetFogAlpha(uint16_t row, uint16_t col) const {
+        if (row >= m_height || col >= m_width) return FOG_ALPHA_UNEXPLORED;
+        return m_fogAlpha[static_cast<size_t>(row) * m_width + col];
+    }
+
+    void FogOfWarRenderer::SetTileAlpha(const TilePosition& tile, uint8_t alpha) {
+        if (tile.row >= m_height || tile.col >= m_width) return;
+        size_t index = static_cast<size_t>(tile.row) * m_width + tile.col;
+        m_fogAlpha[index] = alpha;
+
+        if (!m_texels.empty()) {
+            m_texels[index] = FogTexel(alpha);
+            m_dirtyRowMin = std::min(m_dirtyRowMin, static_cast<int>(tile.row));
+            m_dirtyRowMax = std::max(m_dirtyRowMax, static_cast<int>(tile.row));
+        }
+
+        // Changes outside the current mesh don't force a rebuild
+        if (tile.row >= m_meshMinRow && tile.row <= m_meshMaxRow &&
+            tile.col >= m_meshMinCol && tile.col <= m_meshMaxCol) {
+            m_geometryDirty = true;
+        }
+    }
+
+    void FogOfWarRenderer::GetLatticeBasis(const TileMap& map, Camera2D* camera, const Point& origin,
+                                           float& cx, float& cy, float& rx, float& ry) {
+        // Per-step vectors from the far corners, so TileToScreen rounding averages out
+        Point lastCol = map.TileToScreen(0, static_cast<uint16_t>(map.GetWidth() - 1), camera);
+        Point lastRow = map.TileToScreen(static_cast<uint16_t>(map.GetHeight() - 1), 0, camera);
+        float colSteps = static_cast<float>(std::max(1, map.GetWidth() - 1));
+        float rowSteps = static_cast<float>(std::max(1, map.GetHeight() - 1));
+        cx = (lastCol.x - origin.x) / colSteps;
+        cy = (lastCol.y - origin.y) / colSteps;
+        rx = (lastRow.x - origin.x) / rowSteps;
+        ry = (lastRow.y - origin.y) / rowSteps;
+        if (map.GetWidth() == 1)  { cx = map.GetTileWidth(); cy = -static_cast<float>(map.GetTileHeight()); }
+        if (map.GetHeight() == 1) { rx = map.GetTileWidth(); ry = map.GetTileHeight(); }
+    }
+
+    void FogOfWarRenderer::BuildGeometry(const TileMap& map, const Rect& screenRect, Camera2D* camera) {
+        m_stats = RenderStats{};
+        uint16_t minRow, minCol, maxRow, maxCol;
+        uint16_t mapW = std::min(map.GetWidth(), m_width);
+        uint16_t mapH = std::min(map.GetHeight(), m_height);
+        if (mapW == 0 || mapH == 0 || !map.GetTileRangeInRect(screenRect, minRow, minCol, maxRow, maxCol, camera)) {
+            m_vertices.clear();
+            m_indices.clear();
+            m_geometryDirty = true;
+            return;
+        }
+        maxRow = std::min<uint16_t>(maxRow, mapH - 1);
+        maxCol = std::min<uint16_t>(maxCol, mapW - 1);
+        m_stats.tilesInView = (minRow <= maxRow && minCol <= maxCol)
+            ? static_cast<size_t>(maxRow - minRow + 1) * (maxCol - minCol + 1) : 0;
+
+        // Tile lattice: corner (r, c) sits at origin + c * alongCol + r * alongRow,
+        // so every diamond comes from one affine map (tracks camera pan and zoom)
+        Point origin = map.TileToScreen(0, 0, camera);
+        Point farCorner = map.TileToScreen(static_cast<uint16_t>(map.GetHeight() - 1),
+                                           static_cast<uint16_t>(map.GetWidth() - 1), camera);
+        bool sameView = !m_geometryDirty
+            && minRow == m_meshMinRow && minCol == m_meshMinCol
+            && maxRow == m_meshMaxRow && maxCol == m_meshMaxCol
+            && origin.x == m_meshOrigin.x && origin.y == m_meshOrigin.y
+            && farCorner.x == m_meshFarCorner.x && farCorner.y == m_meshFarCorner.y;
+        if (!sameView) {
+            float cx, cy, rx, ry;
+            GetLatticeBasis(map, camera, origin, cx, cy, rx, ry);
+
+            m_vertices.clear();
+            m_indices.clear();
+            for (uint16_t row = minRow; row <= maxRow; ++row) {
+                for (uint16_t col = minCol; col <= maxCol; ++col) {
+                    uint8_t alpha = m_fogAlpha[static_cast<size_t>(row) * m_width + col];
+                    if (alpha == FOG_ALPHA_VISIBLE) continue;
+
+                    // Diamond corners: left (r, c), top (r, c+1), right (r+1, c+1), bottom (r+1, c)
+                    float x = origin.x + col * cx + row * rx;
+                    float y = origin.y + col * cy + row * ry;
+                    SDL_FColor fogColor = {0.0f, 0.0f, 0.0f, alpha / 255.0f};
+                    int base = static_cast<int>(m_vertices.size());
+                    m_vertices.push_back(SDL_Vertex{{x, y}, fogColor, {0, 0}});
+                    m_vertices.push_back(SDL_Vertex{{x + cx, y + cy}, fogColor, {0, 0}});
+                    m_vertices.push_back(SDL_Vertex{{x + cx + rx, y + cy + ry}, fogColor, {0, 0}});
+                    m_vertices.push_back(SDL_Vertex{{x + rx, y + ry}, fogColor, {0, 0}});
+                    const int quad[6] = {base, base + 1, base + 2, base, base + 2, base + 3};
+                    m_indices.insert(m_indices.end(), quad, quad + 6);
+                }
+            }
+
+            m_meshMinRow = minRow; m_meshMinCol = minCol;
+            m_meshMaxRow = maxRow; m_meshMaxCol = maxCol;
+            m_meshOrigin = origin;
+            m_meshFarCorner = farCorner;
+            m_geometryDirty = false;
+            m_stats.rebuilt = true;
+        }
+
+        m_stats.fogTiles = m_vertices.size() / 4;
+        m_stats.vertices = m_vertices.size();
+        m_stats.indices = m_indices.size();
+    }
+
+    void FogOfWarRenderer::SetMode(FogRenderMode mode) {
+        if (m_mode == mode) return;
+        m_mode = mode;
+        if (m_mode == FogRenderMode::Texture) {
+            RebuildTexels();
+        } else {
+            m_texels.clear();
+            m_texels.shrink_to_fit();
+            m_fogTexture.reset();
+            m_geometryDirty = true;
+        }
+    }
+
+    void FogOfWarRenderer::RebuildTexels() {
+        m_texels.resize(m_fogAlpha.size());
+        for (size_t i = 0; i < m_fogAlpha.size(); ++i) {
+            m_texels[i] = FogTexel(m_fogAlpha[i]);
+        }
+        m_dirtyRowMin = 0;
+        m_dirtyRowMax = static_cast<int>(m_height) - 1;
+    }
+
+    size_t FogOfWarRenderer::TakeDirtyRows(int& firstRow, int& lastRow) {
+        firstRow = m_dirtyRowMin;
+        lastRow = m_dirtyRowMax;
+        m_dirtyRowMin = INT_MAX;
+        m_dirtyRowMax = -1;
+        if (firstRow > lastRow) return 0;
+        return static_cast<size_t>(lastRow - firstRow + 1) * m_width;
+    }
+
+    void FogOfWarRenderer::BuildTextureQuad(const TileMap& map, const Rect& screenRect, Camera2D* camera) {
+        m_stats = RenderStats{};
+        m_vertices.clear();
+        m_indices.clear();
+        uint16_t minRow, minCol, maxRow, maxCol;
+        uint16_t mapW = std::min(map.GetWidth(), m_width);
+        uint16_t mapH = std::min(map.GetHeight(), m_height);
+        if (mapW == 0 || mapH == 0 || !map.GetTileRangeInRect(screenRect, minRow, minCol, maxRow, maxCol, camera)) {
+            return;
+        }
+        maxRow = std::min<uint16_t>(maxRow, mapH - 1);
+        maxCol = std::min<uint16_t>(maxCol, mapW - 1);
+        m_stats.tilesInView = static_cast<size_t>(maxRow - minRow + 1) * (maxCol - minCol + 1);
+
+        // One quad over the visible tile rectangle. Texel (r, c) covers lattice
+        // cell [r, r+1] x [c, c+1], so lattice corners map straight to texture
+        // edges and the affine warp is exact across both triangles.
+        Point origin = map.TileToScreen(0, 0, camera);
+        float cx, cy, rx, ry;
+        GetLatticeBasis(map, camera, origin, cx, cy, rx, ry);
+
+        const float rows[2] = {static_cast<float>(minRow), static_cast<float>(maxRow + 1)};
+        const float cols[2] = {static_cast<float>(minCol), static_cast<float>(maxCol + 1)};
+        const int cornerRow[4] = {0, 0, 1, 1};
+        const int cornerCol[4] = {0, 1, 1, 0};
+        SDL_FColor white = {1.0f, 1.0f, 1.0f, 1.0f};
+        for (int i = 0; i < 4; ++i) {
+            float r = rows[cornerRow[i]];
+            float c = cols[cornerCol[i]];
+            SDL_Vertex v;
+            v.position = {origin.x + c * cx + r * rx, origin.y + c * cy + r * ry};
+            v.color = white;
+            v.tex_coord = {c / m_width, r / m_height};
+            m_vertices.push_back(v);
+        }
+        const int quad[6] = {0, 1, 2, 0, 2, 3};
+        m_indices.assign(quad, quad + 6);
+
+        m_stats.vertices = m_vertices.size();
+        m_stats.indices = m_indices.size();
+        m_stats.rebuilt = true;
+    }
+
     void FogOfWarRenderer::Render(IRenderer* renderer, const TileMap& map,
                                    const LegalCrime::World::VisionSystem& vision,
                                    Camera2D* camera) {
@@ -24,57 +249,56 @@ namespace Engine {
         SDL_Renderer* sdlRenderer = renderer->GetNativeRenderer();
         if (!sdlRenderer) return;
 
-        // Enable blending for semi-transparent fog
-        SDL_SetRenderDrawBlendMode(sdlRenderer, SDL_BLENDMODE_BLEND);
+        if (m_fogAlpha.empty() || m_width != vision.GetWidth() || m_height != vision.GetHeight()) {
+            Sync(vision);
+        }
 
-        uint16_t mapW = map.GetWidth();
-        uint16_t mapH = map.GetHeight();
-
-        for (uint16_t row = 0; row < mapH; ++row) {
-            for (uint16_t col = 0; col < mapW; ++col) {
-                auto vis = vision.GetVisibility(row, col);
-                if (vis == LegalCrime::World::TileVisibility::Visible) continue;
-
-                // Get tile screen position
-                Point tileScreen = map.TileToScreen(row, col, camera);
-                int tw = map.GetTileWidth();
-                int th = map.GetTileHeight();
-
-                // Draw isometric diamond as filled fog
-                // Diamond points: top, right, bottom, left
-                float cx = tileScreen.x + tw;
-                float cy = static_cast<float>(tileScreen.y);
-                SDL_FPoint diamond[4] = {
-                    {cx,              cy - th * 0.5f},  // top
-                    {cx + tw,         cy},               // right
-                    {cx,              cy + th * 0.5f},  // bottom
-                    {cx - tw,         cy}                // left
-                };
-
-                uint8_t alpha = (vis == LegalCrime::World::TileVisibility::Unexplored) ? 255 : 140;
-                SDL_SetRenderDrawColor(sdlRenderer, 0, 0, 0, alpha);
-
-                // Fill with two triangles
-                SDL_FPoint tri1[3] = {diamond[0], diamond[1], diamond[2]};
-                SDL_FPoint tri2[3] = {diamond[0], diamond[2], diamond[3]};
-
-                // Use SDL_RenderGeometry for filled triangles
-                SDL_Vertex verts[6];
-                SDL_FColor fogColor = {0.0f, 0.0f, 0.0f, alpha / 255.0f};
-                for (int i = 0; i < 3; ++i) {
-                    verts[i].position = tri1[i];
-                    verts[i].color = fogColor;
-                    verts[i].tex_coord = {0, 0};
-                }
-                for (int i = 0; i < 3; ++i) {
-                    verts[3 + i].position = tri2[i];
-                    verts[3 + i].color = fogColor;
-                    verts[3 + i].tex_coord = {0, 0};
+        int viewW = 0, viewH = 0;
+        if (camera) {
+            viewW = camera->GetViewportWidth();
+            viewH = camera->GetViewportHeight();
+        } else {
+            SDL_GetCurrentRenderOutputSize(sdlRenderer, &viewW, &viewH);
+        }
+        Rect screen(0, 0, viewW, viewH);
+
+        SDL_Texture* texture = nullptr;
+        if (m_mode == FogRenderMode::Texture) {
+            if (!m_fogTexture || m_fogTexture->GetWidth() != m_width || m_fogTexture->GetHeight() != m_height) {
+                SDL_Texture* tex = SDL_CreateTexture(sdlRenderer, SDL_PIXELFORMAT_RGBA8888,
+                                                      SDL_TEXTUREACCESS_STREAMING, m_width, m_height);
+                if (!tex) {
+                    if (m_logger) m_logger->Warning("FogOfWarRenderer: streaming fog texture unavailable");
+                    return;
                 }
+                SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+                SDL_SetTextureScaleMode(tex, SDL_SCALEMODE_LINEAR);  // Soft fog edges
+                m_fogTexture = Texture::CreateFromSDL(tex, m_width, m_height);
+                m_dirtyRowMin = 0;
+                m_dirtyRowMax = static_cast<int>(m_height) - 1;
+            }
+            texture = m_fogTexture->GetSDLTexture();
 
-                SDL_RenderGeometry(sdlRenderer, nullptr, verts, 6, nullptr, 0);
+            int firstRow, lastRow;
+            size_t texels = TakeDirtyRows(firstRow, lastRow);
+            if (texels > 0) {
+                SDL_Rect rows{0, firstRow, m_width, lastRow - firstRow + 1};
+                SDL_UpdateTexture(texture, &rows, &m_texels[static_cast<size_t>(firstRow) * m_width],
+                                  static_cast<int>(m_width * sizeof(uint32_t)));
             }
+            BuildTextureQuad(map, screen, camera);
+            m_stats.texelsUploaded = texels;
+        } else {
+            BuildGeometry(map, screen, camera);
         }
+        if (m_indices.empty()) return;
+
+        // Enable blending for semi-transparent fog
+        SDL_SetRenderDrawBlendMode(sdlRenderer, SDL_BLENDMODE_BLEND);
+        SDL_RenderGeometry(sdlRenderer, texture,
+                           m_vertices.data(), static_cast<int>(m_vertices.size()),
+                           m_indices.data(), static_cast<int>(m_indices.size()));
+        m_stats.drawCalls = 1;
     }
 
 } // namespace Engine
@@ -1,6 +1,13 @@
 #pragma once
 
 #include "../Core/Types.h"
+#include "../Graphics/Texture.h"
+#include <SDL3/SDL.h>
+#include <climits>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
 
 namespace Engine {
     class IRenderer;
@@ -12,30 +19,117 @@ namespace Engine {
 namespace LegalCrime {
 namespace World {
     class VisionSystem;
+    struct VisibilityChanges;
 }
 }
 
 namespace Engine {
 
+    /// How FogOfWarRenderer draws the fog.
+    enum class FogRenderMode : uint8_t {
+        Geometry,  // One diamond per fogged tile, hard edges
+        Texture    // One texel per tile on a warped quad, linear-filtered soft edges
+    };
+
     /// Renders a fog-of-war overlay on top of the tilemap.
     /// Unexplored tiles are fully black, explored tiles are semi-transparent.
+    /// Fog alpha is cached per tile: Sync reads the whole vision grid once,
+    /// after that ApplyChanges touches only the tiles in a VisionSystem
+    /// change set, and Render never queries the vision system.
+    ///
+    /// Geometry: fogged tiles inside the camera's tile range become one
+    /// indexed triangle list submitted with a single SDL_RenderGeometry.
+    /// The buffers persist and are rebuilt only when the fog or the view
+    /// changes.
+    ///
+    /// Texture mode instead keeps a mapWidth x mapHeight streaming texture
+    /// (black, fog in alpha), uploads only the band of rows that changed and
+    /// draws it as one isometric-warped quad clipped to the visible tiles.
     class FogOfWarRenderer {
     public:
+        struct RenderStats {
+            size_t tilesInView = 0;   // Tiles in the culled range
+            size_t fogTiles = 0;      // Of those, tiles drawn (not Visible)
+            size_t vertices = 0;
+            size_t indices = 0;
+            size_t drawCalls = 0;
+            bool rebuilt = false;     // Buffers regenerated this frame
+            size_t texelsUploaded = 0; // Texture mode: texels sent this frame
+        };
+
         FogOfWarRenderer(ILogger* logger = nullptr);
         ~FogOfWarRenderer();
 
-        /// Render the fog overlay based on the current vision state.
+        /// Render the fog overlay. Syncs from vision first if the cache is
+        /// empty or sized for a different grid.
         void Render(IRenderer* renderer, const TileMap& map,
                     const LegalCrime::World::VisionSystem& vision,
                     Camera2D* camera = nullptr);
 
+        /// Rebuild the whole per-tile fog cache from vision.
+        void Sync(const LegalCrime::World::VisionSystem& vision);
+
+        /// Update only the tiles listed in changes (VisionSystem::FlushChanges).
+        void ApplyChanges(const LegalCrime::World::VisionSystem& vision,
+                          const LegalCrime::World::VisibilityChanges& changes);
+
+        /// Cached fog alpha of a tile: 0 visible, 140 explored, 255 unexplored.
+        uint8_t GetFogAlpha(uint16_t row, uint16_t col) const;
+
+        /// Tiles written by the last Sync / ApplyChanges.
+        size_t GetLastUpdatedTileCount() const { return m_lastUpdatedTiles; }
+
+        /// Build (or keep) the fog mesh for the tiles overlapping screenRect.
+        /// Render calls this; exposed so the mesh can be inspected without a renderer.
+        void BuildGeometry(const TileMap& map, const Rect& screenRect, Camera2D* camera = nullptr);
+
+        /// Texture-mode counterpart of BuildGeometry: the single clipped quad.
+        void BuildTextureQuad(const TileMap& map, const Rect& screenRect, Camera2D* camera = nullptr);
+
+        /// Rows of texels changed since the last call (clears the band).
+        /// Returns the texel count, 0 when nothing is pending.
+        size_t TakeDirtyRows(int& firstRow, int& lastRow);
+
+        void SetMode(FogRenderMode mode);
+        FogRenderMode GetMode() const { return m_mode; }
+
+        const std::vector<SDL_Vertex>& GetVertices() const { return m_vertices; }
+        const std::vector<int>& GetIndices() const { return m_indices; }
+        const RenderStats& GetLastRenderStats() const { return m_stats; }
+
         /// Enable/disable fog rendering.
         void SetEnabled(bool enabled) { m_enabled = enabled; }
         bool IsEnabled() const { return m_enabled; }
 
     private:
+        void SetTileAlpha(const TilePosition& tile, uint8_t alpha);
+        void RebuildTexels();
+        static void GetLatticeBasis(const TileMap& map, Camera2D* camera, const Point& origin,
+                                    float& cx, float& cy, float& rx, float& ry);
+
         ILogger* m_logger;
         bool m_enabled;
+
+        uint16_t m_width = 0;
+        uint16_t m_height = 0;
+        std::vector<uint8_t> m_fogAlpha;  // row-major per tile
+        size_t m_lastUpdatedTiles = 0;
+
+        // Batched mesh and the view it was built for
+        std::vector<SDL_Vertex> m_vertices;
+        std::vector<int> m_indices;
+        bool m_geometryDirty = true;
+        uint16_t m_meshMinRow = 0, m_meshMinCol = 0, m_meshMaxRow = 0, m_meshMaxCol = 0;
+        Point m_meshOrigin;
+        Point m_meshFarCorner;
+        RenderStats m_stats;
+
+        // Texture mode
+        FogRenderMode m_mode = FogRenderMode::Geometry;
+        std::vector<uint32_t> m_texels;   // RGBA8888 per tile; empty in Geometry mode
+        std::shared_ptr<Texture> m_fogTexture;
+        int m_dirtyRowMin = INT_MAX;
+        int m_dirtyRowMax = -1;
     };
 
 } // namespace Engine
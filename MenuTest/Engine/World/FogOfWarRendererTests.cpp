@@ -0,0 +1,112 @@
+#include "../../Tests/SimpleTest.h"
+#include "FogOfWarRenderer.h"
+#include "TileMap.h"
+#include "../../Game/World/Systems/VisionSystem.h"
+
+using namespace Engine;
+using namespace SimpleTest;
+
+TEST_CASE(FogOfWarRenderer_BuildGeometry_CullsToScreen) {
+    TileMap map(100, 100, nullptr);
+    map.Initialize(1024, 768);
+    LegalCrime::World::VisionSystem vision(100, 100);
+    FogOfWarRenderer fog;
+    fog.Sync(vision);
+
+    Rect screen(0, 0, 1024, 768);
+    fog.BuildGeometry(map, screen);
+    const auto& stats = fog.GetLastRenderStats();
+    ASSERT_TRUE(stats.tilesInView > 0);
+    ASSERT_TRUE(stats.tilesInView < (size_t)10000);
+    ASSERT_EQUAL(stats.fogTiles, stats.tilesInView);  // Nothing revealed yet
+    ASSERT_EQUAL(stats.vertices, stats.fogTiles * 4);
+    ASSERT_EQUAL(stats.indices, stats.fogTiles * 6);
+
+    // Every tile with a diamond corner on screen must be in the mesh range
+    uint16_t minRow, minCol, maxRow, maxCol;
+    ASSERT_TRUE(map.GetTileRangeInRect(screen, minRow, minCol, maxRow, maxCol));
+    bool covered = true;
+    for (uint16_t row = 0; row < 100; ++row) {
+        for (uint16_t col = 0; col < 100; ++col) {
+            Point left = map.TileToScreen(row, col);
+            int tw = map.GetTileWidth(), th = map.GetTileHeight();
+            const Point corners[4] = {left, Point(left.x + tw, left.y - th),
+                                      Point(left.x + 2 * tw, left.y), Point(left.x + tw, left.y + th)};
+            bool onScreen = false;
+            for (const Point& p : corners) {
+                onScreen = onScreen || (p.x >= 0 && p.x < 1024 && p.y >= 0 && p.y < 768);
+            }
+            bool inRange = row >= minRow && row <= maxRow && col >= minCol && col <= maxCol;
+            covered = covered && (!onScreen || inRange);
+        }
+    }
+    ASSERT_TRUE(covered);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(FogOfWarRenderer_BuildGeometry_SkipsVisibleAndReusesMesh) {
+    TileMap map(40, 40, nullptr);
+    map.Initialize(4000, 4000);  // Whole map on screen
+    LegalCrime::World::VisionSystem vision(40, 40);
+    vision.RevealAround(TilePosition(20, 20), 3);  // 29 tiles
+    vision.FlushChanges();
+    FogOfWarRenderer fog;
+    fog.Sync(vision);
+
+    Rect screen(0, 0, 4000, 4000);
+    fog.BuildGeometry(map, screen);
+    ASSERT_TRUE(fog.GetLastRenderStats().rebuilt);
+    ASSERT_EQUAL(fog.GetLastRenderStats().tilesInView, (size_t)1600);
+    ASSERT_EQUAL(fog.GetLastRenderStats().fogTiles, (size_t)(1600 - 29));
+
+    // Same view, same fog: buffers are kept
+    fog.BuildGeometry(map, screen);
+    ASSERT_FALSE(fog.GetLastRenderStats().rebuilt);
+    ASSERT_EQUAL(fog.GetLastRenderStats().vertices, (size_t)((1600 - 29) * 4));
+
+    // A change set in view triggers one rebuild
+    vision.BeginFrame();
+    vision.RevealAround(TilePosition(20, 21), 3);
+    fog.ApplyChanges(vision, vision.FlushChanges());
+    fog.BuildGeometry(map, screen);
+    ASSERT_TRUE(fog.GetLastRenderStats().rebuilt);
+    ASSERT_EQUAL(fog.GetLastRenderStats().fogTiles, (size_t)(1600 - 29));
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(FogOfWarRenderer_TextureMode_OneQuadAndDirtyRows) {
+    TileMap map(40, 30, nullptr);
+    map.Initialize(4000, 4000);  // Whole map on screen
+    LegalCrime::World::VisionSystem vision(40, 30);
+    FogOfWarRenderer fog;
+    fog.Sync(vision);
+    fog.SetMode(FogRenderMode::Texture);
+
+    // Switching modes schedules a full upload
+    int firstRow, lastRow;
+    ASSERT_EQUAL(fog.TakeDirtyRows(firstRow, lastRow), (size_t)(40 * 30));
+    ASSERT_EQUAL(firstRow, 0);
+    ASSERT_EQUAL(lastRow, 29);
+    ASSERT_EQUAL(fog.TakeDirtyRows(firstRow, lastRow), (size_t)0);
+
+    fog.BuildTextureQuad(map, Rect(0, 0, 4000, 4000));
+    const auto& verts = fog.GetVertices();
+    ASSERT_EQUAL(verts.size(), (size_t)4);
+    ASSERT_EQUAL(fog.GetIndices().size(), (size_t)6);
+    ASSERT_FLOAT_NEAR(verts[0].tex_coord.x, 0.0f, 0.0001f);
+    ASSERT_FLOAT_NEAR(verts[2].tex_coord.x, 1.0f, 0.0001f);
+    ASSERT_FLOAT_NEAR(verts[2].tex_coord.y, 1.0f, 0.0001f);
+
+    // Quad corners sit on the map's outer tile corners
+    Point topLeft = map.TileToScreen(0, 0);
+    ASSERT_FLOAT_NEAR(verts[0].position.x, (float)topLeft.x, 1.0f);
+    ASSERT_FLOAT_NEAR(verts[0].position.y, (float)topLeft.y, 1.0f);
+
+    // A change set dirties only the rows it touches
+    vision.RevealAround(TilePosition(12, 20), 2);
+    fog.ApplyChanges(vision, vision.FlushChanges());
+    ASSERT_EQUAL(fog.TakeDirtyRows(firstRow, lastRow), (size_t)(5 * 40));
+    ASSERT_EQUAL(firstRow, 10);
+    ASSERT_EQUAL(lastRow, 14);
+    return TestResult{__FUNCTION__, true, ""};
+}
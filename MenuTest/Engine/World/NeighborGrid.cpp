@@ -0,0 +1,43 @@
+#include "NeighborGrid.h"
+
+namespace Engine {
+
+    void NeighborGrid::Build(const float* xs, const float* ys, size_t count, float cellSize) {
+        m_cellSize = (cellSize > 0.0f) ? cellSize : 1.0f;
+        m_invCellSize = 1.0f / m_cellSize;
+
+        // Power-of-two table with ~2 buckets per point keeps chains short
+        uint32_t bucketCount = 16;
+        while (static_cast<size_t>(bucketCount) < count * 2) {
+            bucketCount <<= 1;
+        }
+        m_bucketMask = bucketCount - 1;
+
+        m_bucketStart.assign(static_cast<size_t>(bucketCount) + 1, 0);
+        m_pointBucket.resize(count);
+        for (size_t i = 0; i < count; ++i) {
+            int cx = static_cast<int>(std::floor(xs[i] * m_invCellSize));
+            int cy = static_cast<int>(std::floor(ys[i] * m_invCellSize));
+            uint32_t bucket = Bucket(cx, cy);
+            m_pointBucket[i] = bucket;
+            ++m_bucketStart[bucket + 1];
+        }
+
+        for (uint32_t b = 0; b < bucketCount; ++b) {
+            m_bucketStart[b + 1] += m_bucketStart[b];
+        }
+
+        // Scatter into bucket order
+        m_sortedX.resize(count);
+        m_sortedY.resize(count);
+        m_sortedIndex.resize(count);
+        m_cursor.assign(m_bucketStart.begin(), m_bucketStart.end() - 1);
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t slot = m_cursor[m_pointBucket[i]]++;
+            m_sortedX[slot] = xs[i];
+            m_sortedY[slot] = ys[i];
+            m_sortedIndex[slot] = static_cast<uint32_t>(i);
+        }
+    }
+
+} // namespace Engine
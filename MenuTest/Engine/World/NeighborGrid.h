@@ -0,0 +1,79 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+
+namespace Engine {
+
+    /// Uniform spatial hash over a point set, rebuilt from scratch each frame.
+    /// Build() counting-sorts the points by hashed cell into contiguous SoA
+    /// arrays, so a neighbourhood query is a handful of [begin, end) ranges
+    /// over packed x/y floats — suited to branch-free or SIMD inner loops.
+    /// Unlike SpatialGrid it holds no entity pointers and needs no
+    /// per-move maintenance.
+    class NeighborGrid {
+    public:
+        /// Rebuild from count points. cellSize must be >= any query radius.
+        void Build(const float* xs, const float* ys, size_t count, float cellSize);
+
+        /// Call func(begin, end) for each sorted range that may hold points
+        /// within cellSize of (x, y): the buckets of the 3x3 cells around it,
+        /// each visited once. Ranges can contain farther points (hash
+        /// collisions), so callers still test distance.
+        template<typename Func>
+        void ForEachNearbyRange(float x, float y, Func&& func) const {
+            if (m_bucketStart.empty()) return;
+
+            int cx = static_cast<int>(std::floor(x * m_invCellSize));
+            int cy = static_cast<int>(std::floor(y * m_invCellSize));
+            uint32_t visited[9];
+            int visitedCount = 0;
+            for (int oy = -1; oy <= 1; ++oy) {
+                for (int ox = -1; ox <= 1; ++ox) {
+                    uint32_t bucket = Bucket(cx + ox, cy + oy);
+                    bool seen = false;
+                    for (int v = 0; v < visitedCount; ++v) {
+                        seen = seen || (visited[v] == bucket);
+                    }
+                    if (seen) continue;
+                    visited[visitedCount++] = bucket;
+
+                    uint32_t begin = m_bucketStart[bucket];
+                    uint32_t end = m_bucketStart[bucket + 1];
+                    if (begin != end) {
+                        func(static_cast<size_t>(begin), static_cast<size_t>(end));
+                    }
+                }
+            }
+        }
+
+        /// Points in bucket order. GetSortedIndex maps back to Build's input order.
+        const float* GetSortedX() const { return m_sortedX.data(); }
+        const float* GetSortedY() const { return m_sortedY.data(); }
+        const uint32_t* GetSortedIndex() const { return m_sortedIndex.data(); }
+
+        size_t GetPointCount() const { return m_sortedX.size(); }
+        size_t GetBucketCount() const { return m_bucketStart.empty() ? 0 : m_bucketStart.size() - 1; }
+        float GetCellSize() const { return m_cellSize; }
+
+    private:
+        uint32_t Bucket(int cx, int cy) const {
+            uint32_t h = (static_cast<uint32_t>(cx) * 73856093u) ^ (static_cast<uint32_t>(cy) * 19349663u);
+            return h & m_bucketMask;
+        }
+
+        float m_cellSize = 1.0f;
+        float m_invCellSize = 1.0f;
+        uint32_t m_bucketMask = 0;
+
+        std::vector<uint32_t> m_bucketStart;   // bucketCount + 1 prefix offsets
+        std::vector<uint32_t> m_pointBucket;   // Scratch: bucket per input point
+        std::vector<uint32_t> m_cursor;        // Scratch: write position per bucket
+        std::vector<float> m_sortedX;
+        std::vector<float> m_sortedY;
+        std::vector<uint32_t> m_sortedIndex;
+    };
+
+} // namespace Engine
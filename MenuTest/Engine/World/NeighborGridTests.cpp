@@ -0,0 +1,70 @@
+#include "../../Tests/SimpleTest.h"
+#include "NeighborGrid.h"
+#include <cstdlib>
+
+using namespace Engine;
+using namespace SimpleTest;
+
+TEST_CASE(NeighborGrid_Build_SortsEveryPointOnce) {
+    std::vector<float> xs, ys;
+    for (int i = 0; i < 500; ++i) {
+        xs.push_back(static_cast<float>((i * 37) % 1000));
+        ys.push_back(static_cast<float>((i * 91) % 700));
+    }
+
+    NeighborGrid grid;
+    grid.Build(xs.data(), ys.data(), xs.size(), 40.0f);
+    ASSERT_EQUAL(grid.GetPointCount(), (size_t)500);
+    ASSERT_TRUE(grid.GetBucketCount() >= 1000);
+
+    std::vector<int> seen(500, 0);
+    for (size_t i = 0; i < grid.GetPointCount(); ++i) {
+        uint32_t original = grid.GetSortedIndex()[i];
+        seen[original]++;
+        ASSERT_FLOAT_NEAR(grid.GetSortedX()[i], xs[original], 0.0001f);
+        ASSERT_FLOAT_NEAR(grid.GetSortedY()[i], ys[original], 0.0001f);
+    }
+    for (int count : seen) ASSERT_EQUAL(count, 1);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(NeighborGrid_NearbyRanges_MatchBruteForce) {
+    std::srand(7);
+    std::vector<float> xs, ys;
+    for (int i = 0; i < 2000; ++i) {
+        xs.push_back(static_cast<float>(std::rand() % 2000) - 500.0f);  // Negative cells too
+        ys.push_back(static_cast<float>(std::rand() % 2000) - 500.0f);
+    }
+
+    const float radius = 40.0f;
+    NeighborGrid grid;
+    grid.Build(xs.data(), ys.data(), xs.size(), radius);
+
+    for (size_t q = 0; q < xs.size(); q += 50) {
+        size_t expected = 0;
+        for (size_t j = 0; j < xs.size(); ++j) {
+            float dx = xs[j] - xs[q], dy = ys[j] - ys[q];
+            if (dx * dx + dy * dy < radius * radius) ++expected;
+        }
+
+        size_t found = 0;
+        grid.ForEachNearbyRange(xs[q], ys[q], [&](size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                float dx = grid.GetSortedX()[k] - xs[q], dy = grid.GetSortedY()[k] - ys[q];
+                if (dx * dx + dy * dy < radius * radius) ++found;
+            }
+        });
+        ASSERT_EQUAL(found, expected);
+    }
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(NeighborGrid_Empty_NoRanges) {
+    NeighborGrid grid;
+    int calls = 0;
+    grid.ForEachNearbyRange(0.0f, 0.0f, [&](size_t, size_t) { ++calls; });
+    grid.Build(nullptr, nullptr, 0, 10.0f);
+    grid.ForEachNearbyRange(0.0f, 0.0f, [&](size_t, size_t) { ++calls; });
+    ASSERT_EQUAL(calls, 0);
+    return TestResult{__FUNCTION__, true, ""};
+}
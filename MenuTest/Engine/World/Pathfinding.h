@@ -44,7 +44,7 @@ namespace Engine {
         /// <param name="goal">Goal tile position</param>
         /// <param name="mapWidth">Width of the map in tiles</param>
         /// <param name="mapHeight">Height of the map in tiles</param>
-        /// <param name="isWalkable">Callback to check if a tile is walkable</param>
+        /// <param name="isWalkable">Callback to check if a tile is walkable. Only called with on-map positions, so it may read unchecked tile views</param>
         /// <param name="options">Pathfinding options (diagonal movement, etc.)</param>
         /// <returns>Path from start to goal, or empty if no path found</returns>
         Path FindPath(
@@ -0,0 +1,79 @@
+#include "../../Tests/SimpleTest.h"
+#include "TileBatchBaker.h"
+#include "TileMap.h"
+#include "IsometricMath.h"
+#include "../Renderer/IRenderer.h"
+#include <chrono>
+#include <iostream>
+
+using namespace Engine;
+using namespace SimpleTest;
+
+namespace {
+    class NullRenderer : public IRenderer {
+    public:
+        Result<void> Initialize(IWindow*, const RendererConfig&) override { return Result<void>::Success(); }
+        void Shutdown() override {}
+        void Clear(const Color&) override {}
+        void Present() override {}
+        SDL_Renderer* GetNativeRenderer() const override { return nullptr; }
+        bool SetVSync(bool) override { return true; }
+        bool IsVSyncEnabled() const override { return false; }
+        bool IsInitialized() const override { return true; }
+        void SetDrawColor(uint8_t, uint8_t, uint8_t, uint8_t) override {}
+        void DrawLines(const Point*, int) override {}
+        void DrawCircle(const Point&, int, int) override {}
+    };
+}
+
+TEST_CASE(TileBakeBench_PerTileVsBatched_16x16Chunk) {
+    // One 16x16 chunk, a quarter of it obstacles
+    const int chunk = 16;
+    const int bakes = 2000;
+    TileMap map(chunk, chunk, nullptr);
+    for (uint16_t r = 0; r < chunk; ++r) {
+        for (uint16_t c = 0; c < chunk; ++c) {
+            if ((r * 7 + c * 3) % 4 == 0) map.GetTile(r, c)->SetWalkable(false);
+        }
+    }
+    const uint16_t tw = map.GetTileWidth();
+    const uint16_t th = map.GetTileHeight();
+    const uint16_t originY = chunk * th;
+    NullRenderer renderer;
+
+    // Before: Tile::Render per tile (outline call per tile, one line per fill row)
+    size_t legacyCalls = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int b = 0; b < bakes; ++b) {
+        for (uint16_t r = 0; r < chunk; ++r) {
+            for (uint16_t c = 0; c < chunk; ++c) {
+                const Tile* tile = map.GetTile(r, c);
+                tile->Render(&renderer, IsometricMath::TileToLocal(r, c, 0, originY, tw, th), tw, th);
+                if (b == 0) legacyCalls += tile->IsWalkable() ? 2 : 2 + 3 + (2 * th + 1);
+            }
+        }
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+
+    // After: one geometry batch plus two outline strips
+    TileBatchBaker baker;
+    size_t batchedVertices = 0;
+    for (int b = 0; b < bakes; ++b) {
+        Point first = IsometricMath::TileToLocal(0, 0, 0, originY, tw, th);
+        baker.Build(map, 0, 0, chunk, chunk, SDL_FPoint{ (float)first.x, (float)first.y });
+        baker.Draw(nullptr);
+        batchedVertices = baker.GetFillVertices().size();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    size_t batchedCalls = baker.GetFillIndices().empty() ? 3 : 4;
+
+    long long legacyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count() / bakes;
+    long long batchedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count() / bakes;
+    std::cout << "  [bench] Chunk bake 16x16: per-tile " << legacyNs / 1000.0 << " us, " << legacyCalls
+              << " SDL calls; batched " << batchedNs / 1000.0 << " us, " << batchedCalls << " SDL calls, "
+              << batchedVertices << " fill verts" << std::endl;
+
+    ASSERT_EQUAL(baker.GetFillCount(), (size_t)64);
+    ASSERT_TRUE(batchedCalls * 100 < legacyCalls);
+    return TestResult{__FUNCTION__, true, ""};
+}
@@ -0,0 +1,127 @@
+#include "TileBatchBaker.h"
+#include "TileMap.h"
+#include "../Graphics/TileAtlas.h"
+
+namespace Engine {
+
+    namespace {
+        // Same colours as Tile::Render
+        const SDL_FColor OBSTACLE_FILL{ 180.0f / 255.0f, 50.0f / 255.0f, 50.0f / 255.0f, 1.0f };
+        const SDL_FColor SPRITE_TINT{ 1.0f, 1.0f, 1.0f, 1.0f };
+    }
+
+    void TileBatchBaker::AppendQuad(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                                    const SDL_Vertex& v0, const SDL_Vertex& v1,
+                                    const SDL_Vertex& v2, const SDL_Vertex& v3) {
+        int base = static_cast<int>(vertices.size());
+        vertices.push_back(v0);
+        vertices.push_back(v1);
+        vertices.push_back(v2);
+        vertices.push_back(v3);
+        indices.push_back(base);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+    }
+
+    void TileBatchBaker::Build(const TileMap& map, int rowBegin, int colBegin, int rowEnd, int colEnd,
+                               const SDL_FPoint& origin) {
+        m_fillVertices.clear();
+        m_fillIndices.clear();
+        m_columnStrip.clear();
+        m_rowStrip.clear();
+        m_spriteCount = 0;
+        // Keep per-page buffers (and their capacity) across builds
+        m_pageBatches.resize(m_atlas ? m_atlas->GetPageCount() : 0);
+        for (PageBatch& batch : m_pageBatches) {
+            batch.vertices.clear();
+            batch.indices.clear();
+        }
+        if (rowEnd <= rowBegin || colEnd <= colBegin) return;
+
+        const float tw = static_cast<float>(map.GetTileWidth());
+        const float th = static_cast<float>(map.GetTileHeight());
+
+        // Lattice vertex (r, c) relative to the block: the left vertex of tile (r, c)
+        auto vertex = [&](int r, int c) {
+            int dr = r - rowBegin;
+            int dc = c - colBegin;
+            return SDL_FPoint{ origin.x + (dc + dr) * tw, origin.y - (dc - dr) * th };
+        };
+
+        for (int r = rowBegin; r < rowEnd; ++r) {
+            for (int c = colBegin; c < colEnd; ++c) {
+                const Tile* tile = map.GetTile(static_cast<uint16_t>(r), static_cast<uint16_t>(c));
+                if (!tile) continue;
+
+                const TileAtlas::Entry* art = m_atlas ? m_atlas->Find(tile->GetId()) : nullptr;
+                if (art) {
+                    // Diamond bounding box: left vertex x, top vertex y to
+                    // right vertex x, bottom vertex y
+                    SDL_FPoint left = vertex(r, c);
+                    float x0 = left.x;
+                    float x1 = left.x + 2.0f * tw;
+                    float y0 = left.y - th;
+                    float y1 = left.y + th;
+                    PageBatch& batch = m_pageBatches[art->page];
+                    AppendQuad(batch.vertices, batch.indices,
+                               SDL_Vertex{ SDL_FPoint{ x0, y0 }, SPRITE_TINT, SDL_FPoint{ art->uvMin.x, art->uvMin.y } },
+                               SDL_Vertex{ SDL_FPoint{ x1, y0 }, SPRITE_TINT, SDL_FPoint{ art->uvMax.x, art->uvMin.y } },
+                               SDL_Vertex{ SDL_FPoint{ x1, y1 }, SPRITE_TINT, SDL_FPoint{ art->uvMax.x, art->uvMax.y } },
+                               SDL_Vertex{ SDL_FPoint{ x0, y1 }, SPRITE_TINT, SDL_FPoint{ art->uvMin.x, art->uvMax.y } });
+                    ++m_spriteCount;
+                    continue;
+                }
+                if (tile->IsWalkable()) continue;
+
+                AppendQuad(m_fillVertices, m_fillIndices,
+                           SDL_Vertex{ vertex(r, c), OBSTACLE_FILL, SDL_FPoint{ 0.0f, 0.0f } },
+                           SDL_Vertex{ vertex(r, c + 1), OBSTACLE_FILL, SDL_FPoint{ 0.0f, 0.0f } },
+                           SDL_Vertex{ vertex(r + 1, c + 1), OBSTACLE_FILL, SDL_FPoint{ 0.0f, 0.0f } },
+                           SDL_Vertex{ vertex(r + 1, c), OBSTACLE_FILL, SDL_FPoint{ 0.0f, 0.0f } });
+            }
+        }
+
+        // Column lines run rowBegin -> rowEnd and back, stepping along the
+        // first and last row lines; row lines likewise along the end columns
+        for (int c = colBegin; c <= colEnd; ++c) {
+            bool down = ((c - colBegin) & 1) == 0;
+            m_columnStrip.push_back(vertex(down ? rowBegin : rowEnd, c));
+            m_columnStrip.push_back(vertex(down ? rowEnd : rowBegin, c));
+        }
+        for (int r = rowBegin; r <= rowEnd; ++r) {
+            bool forward = ((r - rowBegin) & 1) == 0;
+            m_rowStrip.push_back(vertex(r, forward ? colBegin : colEnd));
+            m_rowStrip.push_back(vertex(r, forward ? colEnd : colBegin));
+        }
+    }
+
+    size_t TileBatchBaker::Draw(SDL_Renderer* renderer) const {
+        if (!renderer || m_columnStrip.empty()) return 0;
+
+        size_t calls = 0;
+        for (size_t page = 0; page < m_pageBatches.size(); ++page) {
+            const PageBatch& batch = m_pageBatches[page];
+            if (batch.indices.empty()) continue;
+            SDL_RenderGeometry(renderer, m_atlas->GetPageTexture(static_cast<int>(page)),
+                               batch.vertices.data(), static_cast<int>(batch.vertices.size()),
+                               batch.indices.data(), static_cast<int>(batch.indices.size()));
+            ++calls;
+        }
+
+        if (!m_fillIndices.empty()) {
+            SDL_RenderGeometry(renderer, nullptr,
+                               m_fillVertices.data(), static_cast<int>(m_fillVertices.size()),
+                               m_fillIndices.data(), static_cast<int>(m_fillIndices.size()));
+            ++calls;
+        }
+
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+        SDL_RenderLines(renderer, m_columnStrip.data(), static_cast<int>(m_columnStrip.size()));
+        SDL_RenderLines(renderer, m_rowStrip.data(), static_cast<int>(m_rowStrip.size()));
+        return calls + 3;
+    }
+
+} // namespace Engine
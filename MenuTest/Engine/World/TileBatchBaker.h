@@ -0,0 +1,76 @@
+#pragma once
+
+#include <SDL3/SDL.h>
+#include <cstddef>
+#include <vector>
+
+namespace Engine {
+
+    class TileMap;
+    class TileAtlas;
+
+    /// Batches a rectangular block of tiles for baking into a chunk texture.
+    /// Obstacle fills become one indexed triangle list (one SDL_RenderGeometry)
+    /// and outlines become two polylines (one SDL_RenderLines each), instead
+    /// of Tile::Render's outline call per tile and line call per fill row.
+    ///
+    /// A block's outlines are exactly its lattice lines of constant column and
+    /// of constant row. Each family is traced as one zig-zag strip whose
+    /// connecting legs run along the block's own border edges, so the strips
+    /// draw nothing the per-tile outlines would not.
+    ///
+    /// With a TileAtlas set, tiles whose id has art become textured quads
+    /// over the diamond's bounding box, batched per atlas page (one
+    /// SDL_RenderGeometry per page in use). Art replaces the obstacle fill;
+    /// tiles without art keep the procedural look.
+    /// Buffers are kept between builds.
+    class TileBatchBaker {
+    public:
+        /// Batch tiles [rowBegin, rowEnd) x [colBegin, colEnd). origin is the
+        /// target-space position of the left vertex of tile (rowBegin, colBegin).
+        void Build(const TileMap& map, int rowBegin, int colBegin, int rowEnd, int colEnd,
+                   const SDL_FPoint& origin);
+
+        /// Draw textured pages, then fills, then outlines over them.
+        /// Returns the SDL calls issued.
+        size_t Draw(SDL_Renderer* renderer) const;
+
+        /// Tile art source, or nullptr for procedural diamonds only. The
+        /// atlas must outlive the baker or be unset first. Drops the current
+        /// textured batches; Build() again before drawing.
+        void SetAtlas(const TileAtlas* atlas) {
+            m_atlas = atlas;
+            m_pageBatches.clear();
+            m_spriteCount = 0;
+        }
+        const TileAtlas* GetAtlas() const { return m_atlas; }
+
+        const std::vector<SDL_Vertex>& GetFillVertices() const { return m_fillVertices; }
+        const std::vector<int>& GetFillIndices() const { return m_fillIndices; }
+        const std::vector<SDL_FPoint>& GetColumnStrip() const { return m_columnStrip; }
+        const std::vector<SDL_FPoint>& GetRowStrip() const { return m_rowStrip; }
+        size_t GetFillCount() const { return m_fillVertices.size() / 4; }
+
+        /// Textured quads batched for one atlas page.
+        struct PageBatch {
+            std::vector<SDL_Vertex> vertices;
+            std::vector<int> indices;
+        };
+        const std::vector<PageBatch>& GetPageBatches() const { return m_pageBatches; }
+        size_t GetSpriteCount() const { return m_spriteCount; }
+
+    private:
+        static void AppendQuad(std::vector<SDL_Vertex>& vertices, std::vector<int>& indices,
+                               const SDL_Vertex& v0, const SDL_Vertex& v1,
+                               const SDL_Vertex& v2, const SDL_Vertex& v3);
+
+        const TileAtlas* m_atlas = nullptr;
+        std::vector<PageBatch> m_pageBatches;  // Indexed by atlas page
+        size_t m_spriteCount = 0;
+        std::vector<SDL_Vertex> m_fillVertices;
+        std::vector<int> m_fillIndices;
+        std::vector<SDL_FPoint> m_columnStrip;  // Lines of constant column
+        std::vector<SDL_FPoint> m_rowStrip;     // Lines of constant row
+    };
+
+} // namespace Engine
@@ -0,0 +1,116 @@
+#include "../../Tests/SimpleTest.h"
+#include "TileBatchBaker.h"
+#include "TileMap.h"
+#include "IsometricMath.h"
+#include "../Graphics/TileAtlas.h"
+
+using namespace Engine;
+using namespace SimpleTest;
+
+TEST_CASE(TileBatchBaker_ObstacleFill_MatchesTileDiamond) {
+    TileMap map(8, 8);
+    map.GetTile(2, 3)->SetWalkable(false);
+    map.GetTile(5, 5)->SetWalkable(false);
+
+    TileBatchBaker baker;
+    baker.Build(map, 0, 0, 8, 8, SDL_FPoint{ 10.0f, 400.0f });
+    ASSERT_EQUAL(baker.GetFillCount(), (size_t)2);
+    ASSERT_EQUAL(baker.GetFillIndices().size(), (size_t)12);
+
+    // Same corners Tile::Render uses: left, top, right, bottom
+    const uint16_t tw = map.GetTileWidth();
+    const uint16_t th = map.GetTileHeight();
+    Point left = IsometricMath::TileToLocal(2, 3, 10, 400, tw, th);
+    const auto& v = baker.GetFillVertices();
+    ASSERT_FLOAT_NEAR(v[0].position.x, (float)left.x, 0.001f);
+    ASSERT_FLOAT_NEAR(v[0].position.y, (float)left.y, 0.001f);
+    ASSERT_FLOAT_NEAR(v[1].position.x, (float)(left.x + tw), 0.001f);
+    ASSERT_FLOAT_NEAR(v[1].position.y, (float)(left.y - th), 0.001f);
+    ASSERT_FLOAT_NEAR(v[2].position.x, (float)(left.x + 2 * tw), 0.001f);
+    ASSERT_FLOAT_NEAR(v[2].position.y, (float)left.y, 0.001f);
+    ASSERT_FLOAT_NEAR(v[3].position.x, (float)(left.x + tw), 0.001f);
+    ASSERT_FLOAT_NEAR(v[3].position.y, (float)(left.y + th), 0.001f);
+    ASSERT_EQUAL(baker.GetFillIndices()[6], 4);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileBatchBaker_OutlineStrips_StayOnLatticeLines) {
+    TileMap map(20, 20);
+    TileBatchBaker baker;
+    baker.Build(map, 4, 6, 8, 11, SDL_FPoint{ 0.0f, 0.0f });  // 4 rows x 5 cols
+    ASSERT_EQUAL(baker.GetFillCount(), (size_t)0);
+
+    // 6 column lines and 5 row lines, two points each
+    const auto& cols = baker.GetColumnStrip();
+    const auto& rows = baker.GetRowStrip();
+    ASSERT_EQUAL(cols.size(), (size_t)12);
+    ASSERT_EQUAL(rows.size(), (size_t)10);
+
+    // Every segment of a strip moves along one lattice axis: a column line
+    // step is (+tw, +th) per row, a row line step (+tw, -th) per column
+    const float tw = map.GetTileWidth();
+    const float th = map.GetTileHeight();
+    bool onLattice = true;
+    auto check = [&](const std::vector<SDL_FPoint>& strip) {
+        for (size_t i = 1; i < strip.size(); ++i) {
+            float dx = (strip[i].x - strip[i - 1].x) / tw;
+            float dy = (strip[i].y - strip[i - 1].y) / th;
+            onLattice = onLattice && (dx == dy || dx == -dy);
+        }
+    };
+    check(cols);
+    check(rows);
+    ASSERT_TRUE(onLattice);
+
+    // The strip's first column line spans all 4 rows
+    ASSERT_FLOAT_NEAR(cols[1].x - cols[0].x, 4 * tw, 0.001f);
+    ASSERT_FLOAT_NEAR(cols[1].y - cols[0].y, 4 * th, 0.001f);
+
+    baker.Build(map, 3, 3, 3, 9, SDL_FPoint{ 0.0f, 0.0f });
+    ASSERT_TRUE(baker.GetColumnStrip().empty());
+    ASSERT_EQUAL(baker.Draw(nullptr), (size_t)0);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileBatchBaker_Atlas_BatchesSpritesPerPage) {
+    TileMap map(8, 8);
+    map.GetTile(1, 1)->SetId(1);
+    map.GetTile(2, 2)->SetId(2);
+    map.GetTile(2, 2)->SetWalkable(false);  // Has art: no procedural fill
+    map.GetTile(3, 3)->SetWalkable(false);  // Id 0, no art: filled
+
+    // Ids 1 and 2 are each too big to share a 128px page
+    TileAtlas atlas;
+    ASSERT_TRUE(atlas.Layout({ 1, 2 }, { { 100, 100 }, { 100, 100 } }, 128));
+    ASSERT_EQUAL(atlas.GetPageCount(), (size_t)2);
+
+    TileBatchBaker baker;
+    baker.SetAtlas(&atlas);
+    baker.Build(map, 0, 0, 8, 8, SDL_FPoint{ 0.0f, 200.0f });
+    ASSERT_EQUAL(baker.GetSpriteCount(), (size_t)2);
+    ASSERT_EQUAL(baker.GetFillCount(), (size_t)1);
+
+    const auto& pages = baker.GetPageBatches();
+    ASSERT_EQUAL(pages.size(), (size_t)2);
+    ASSERT_EQUAL(pages[0].indices.size(), (size_t)6);
+    ASSERT_EQUAL(pages[1].indices.size(), (size_t)6);
+
+    // Sprite quad covers the diamond's bounding box, UVs from the atlas
+    const float tw = map.GetTileWidth();
+    const float th = map.GetTileHeight();
+    const TileAtlas::Entry* art = atlas.Find(1);
+    const auto& quad = pages[art->page].vertices;
+    Point left = IsometricMath::TileToLocal(1, 1, 0, 200, map.GetTileWidth(), map.GetTileHeight());
+    ASSERT_FLOAT_NEAR(quad[0].position.x, (float)left.x, 0.001f);
+    ASSERT_FLOAT_NEAR(quad[0].position.y, (float)left.y - th, 0.001f);
+    ASSERT_FLOAT_NEAR(quad[2].position.x, (float)left.x + 2 * tw, 0.001f);
+    ASSERT_FLOAT_NEAR(quad[2].position.y, (float)left.y + th, 0.001f);
+    ASSERT_FLOAT_NEAR(quad[0].tex_coord.x, art->uvMin.x, 0.0001f);
+    ASSERT_FLOAT_NEAR(quad[2].tex_coord.y, art->uvMax.y, 0.0001f);
+
+    baker.SetAtlas(nullptr);
+    baker.Build(map, 0, 0, 8, 8, SDL_FPoint{ 0.0f, 200.0f });
+    ASSERT_TRUE(baker.GetPageBatches().empty());
+    ASSERT_EQUAL(baker.GetFillCount(), (size_t)2);
+    return TestResult{__FUNCTION__, true, ""};
+}
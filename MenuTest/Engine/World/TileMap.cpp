@@ -3,8 +3,10 @@
 #include "../Renderer/IRenderer.h"
 #include "../Core/Logger/ILogger.h"
 #include "../Camera/Camera2D.h"
+#include "../Core/BitOps.h"
 #include <SDL3/SDL.h>
 #include <cmath>
+#include <algorithm>
 
 namespace Engine {
     
@@ -74,13 +76,7 @@ namespace Engine {
         IsometricMath::CalculateMapSize(width, height, m_tileWidth, m_tileHeight,
                                         m_mapSizeWidth, m_mapSizeHeight);
 
-        m_tiles.resize(height);
-        for (uint16_t i = 0; i < height; i++) {
-            m_tiles[i].resize(width);
-            for (uint16_t j = 0; j < width; j++) {
-                m_tiles[i][j].SetId(0);
-            }
-        }
+        m_tiles.assign(static_cast<size_t>(width) * height, Tile(0));
         
         if (m_logger) {
             m_logger->Debug("TileMap created: " + std::to_string(width) + "x" + std::to_string(height));
@@ -116,18 +112,104 @@ namespace Engine {
         return Result<void>::Success();
     }
     
-    Tile* TileMap::GetTile(uint16_t row, uint16_t col) {
-        if (row >= m_mapHeight || col >= m_mapWidth) {
-            return nullptr;
+    bool TileMap::SetTileWalkable(uint16_t row, uint16_t col, bool walkable) {
+        Tile* tile = GetTile(row, col);
+        if (!tile) {
+            return false;
         }
-        return &m_tiles[row][col];
+        if (tile->IsWalkable() != walkable) {
+            tile->SetWalkable(walkable);
+            NotifyTileChanged(row, col);  // Updates the plane first
+        }
+        return true;
     }
-    
-    const Tile* TileMap::GetTile(uint16_t row, uint16_t col) const {
+
+    bool TileMap::SetTileId(uint16_t row, uint16_t col, uint16_t id) {
+        Tile* tile = GetTile(row, col);
+        if (!tile) {
+            return false;
+        }
+        if (tile->GetId() != id) {
+            tile->SetId(id);
+            NotifyTileChanged(row, col);
+        }
+        return true;
+    }
+
+    void TileMap::NotifyTileChanged(uint16_t row, uint16_t col) {
         if (row >= m_mapHeight || col >= m_mapWidth) {
-            return nullptr;
+            return;
+        }
+        if (!m_walkableBits.empty()) {
+            UpdateWalkableBit(row, col, m_tiles[static_cast<size_t>(row) * m_mapWidth + col].IsWalkable());
+        }
+        TilePosition pos(row, col);
+        for (const auto& listener : m_tileListeners) {
+            listener.handler(pos);
+        }
+    }
+
+    size_t TileMap::SubscribeTileChanges(TileChangedHandler handler) {
+        size_t id = m_nextListenerId++;
+        m_tileListeners.push_back({ id, std::move(handler) });
+        return id;
+    }
+
+    void TileMap::UnsubscribeTileChanges(size_t subscriptionId) {
+        m_tileListeners.erase(
+            std::remove_if(m_tileListeners.begin(), m_tileListeners.end(),
+                [subscriptionId](const TileListener& l) { return l.id == subscriptionId; }),
+            m_tileListeners.end());
+    }
+
+    void TileMap::SetWalkabilityPlaneEnabled(bool enabled) {
+        if (!enabled) {
+            m_walkableBits.clear();
+            m_walkableBits.shrink_to_fit();
+            m_walkableWordsPerRow = 0;
+            return;
+        }
+        RebuildWalkabilityPlane();
+    }
+
+    void TileMap::RebuildWalkabilityPlane() {
+        m_walkableWordsPerRow = (static_cast<size_t>(m_mapWidth) + 63) / 64;
+        m_walkableBits.assign(m_walkableWordsPerRow * m_mapHeight, 0);
+        for (uint16_t row = 0; row < m_mapHeight; ++row) {
+            const Tile* tiles = m_tiles.data() + static_cast<size_t>(row) * m_mapWidth;
+            uint64_t* words = &m_walkableBits[static_cast<size_t>(row) * m_walkableWordsPerRow];
+            for (uint16_t col = 0; col < m_mapWidth; ++col) {
+                words[col >> 6] |= static_cast<uint64_t>(tiles[col].IsWalkable() ? 1 : 0) << (col & 63);
+            }
+        }
+    }
+
+    TileMap::WalkabilityView TileMap::GetWalkabilityView() const {
+        if (m_walkableBits.empty()) {
+            return WalkabilityView{ nullptr, 0, m_mapWidth, m_mapHeight };
         }
-        return &m_tiles[row][col];
+        return WalkabilityView{ m_walkableBits.data(), m_walkableWordsPerRow, m_mapWidth, m_mapHeight };
+    }
+
+    size_t TileMap::CountWalkableTiles() const {
+        size_t count = 0;
+        if (!m_walkableBits.empty()) {
+            // Row padding bits are always 0
+            for (uint64_t word : m_walkableBits) {
+                count += static_cast<size_t>(BitOps::PopCount(word));
+            }
+            return count;
+        }
+        for (const Tile& tile : m_tiles) {
+            count += tile.IsWalkable() ? 1 : 0;
+        }
+        return count;
+    }
+
+    void TileMap::UpdateWalkableBit(uint16_t row, uint16_t col, bool walkable) {
+        uint64_t& word = m_walkableBits[static_cast<size_t>(row) * m_walkableWordsPerRow + (col >> 6)];
+        uint64_t mask = uint64_t{ 1 } << (col & 63);
+        word = walkable ? (word | mask) : (word & ~mask);
     }
 
     void TileMap::SetOffset(int x, int y) {
@@ -213,5 +295,57 @@ namespace Engine {
     bool TileMap::ScreenToTile(int screenX, int screenY, TilePosition& outPos, Camera2D* camera) const {
         return ScreenToTile(screenX, screenY, outPos.row, outPos.col, camera);
     }
-}
 
+    bool TileMap::GetTileRangeInRect(const Rect& screenRect,
+                                     uint16_t& minRow, uint16_t& minCol,
+                                     uint16_t& maxRow, uint16_t& maxCol,
+                                     Camera2D* camera) const {
+        if (!m_initialized || m_mapWidth == 0 || m_mapHeight == 0) {
+            return false;
+        }
+
+        // Screen = origin + col * alongCol + row * alongRow; sample the far
+        // corners so integer rounding in TileToScreen averages out
+        Point origin = TileToScreen(0, 0, camera);
+        Point lastCol = TileToScreen(0, static_cast<uint16_t>(m_mapWidth - 1), camera);
+        Point lastRow = TileToScreen(static_cast<uint16_t>(m_mapHeight - 1), 0, camera);
+        float colSteps = static_cast<float>(std::max(1, m_mapWidth - 1));
+        float rowSteps = static_cast<float>(std::max(1, m_mapHeight - 1));
+        float cx = (m_mapWidth > 1) ? (lastCol.x - origin.x) / colSteps : static_cast<float>(m_tileWidth);
+        float cy = (m_mapWidth > 1) ? (lastCol.y - origin.y) / colSteps : -static_cast<float>(m_tileHeight);
+        float rx = (m_mapHeight > 1) ? (lastRow.x - origin.x) / rowSteps : static_cast<float>(m_tileWidth);
+        float ry = (m_mapHeight > 1) ? (lastRow.y - origin.y) / rowSteps : static_cast<float>(m_tileHeight);
+        float det = cx * ry - cy * rx;
+        if (std::fabs(det) < 1e-6f) {
+            return false;
+        }
+
+        float loRow = 1e30f, hiRow = -1e30f, loCol = 1e30f, hiCol = -1e30f;
+        const float xs[2] = {static_cast<float>(screenRect.x), static_cast<float>(screenRect.x + screenRect.w)};
+        const float ys[2] = {static_cast<float>(screenRect.y), static_cast<float>(screenRect.y + screenRect.h)};
+        for (float x : xs) {
+            for (float y : ys) {
+                float dx = x - origin.x;
+                float dy = y - origin.y;
+                float col = (dx * ry - dy * rx) / det;
+                float row = (cx * dy - cy * dx) / det;
+                loRow = std::min(loRow, row); hiRow = std::max(hiRow, row);
+                loCol = std::min(loCol, col); hiCol = std::max(hiCol, col);
+            }
+        }
+
+        // A tile's diamond spans one lattice step past its anchor vertex
+        int r0 = std::max(0, static_cast<int>(std::floor(loRow)) - 2);
+        int c0 = std::max(0, static_cast<int>(std::floor(loCol)) - 2);
+        int r1 = std::min(static_cast<int>(m_mapHeight) - 1, static_cast<int>(std::ceil(hiRow)) + 1);
+        int c1 = std::min(static_cast<int>(m_mapWidth) - 1, static_cast<int>(std::ceil(hiCol)) + 1);
+        if (r0 > r1 || c0 > c1) {
+            return false;
+        }
+        minRow = static_cast<uint16_t>(r0);
+        minCol = static_cast<uint16_t>(c0);
+        maxRow = static_cast<uint16_t>(r1);
+        maxCol = static_cast<uint16_t>(c1);
+        return true;
+    }
+}
@@ -3,6 +3,7 @@
 #include "../Core/Types.h"
 #include "IsometricMath.h"
 #include <SDL3/SDL.h>
+#include <functional>
 #include <vector>
 #include <memory>
 #include <string>
@@ -43,6 +44,12 @@ namespace Engine {
     
     /// TileMap: owns tile data, dimensions, and coordinate conversions.
     /// Rendering is handled by TileMapRenderer (SRP).
+    ///
+    /// Tiles live in one row-major array (index row * width + col). Hot
+    /// readers that scan many tiles take a TileView or WalkabilityView
+    /// once and index it without per-tile bounds checks. The optional
+    /// walkability plane keeps one bit per tile alongside the array, so
+    /// walkability scans touch 1/32 of the memory.
     class TileMap {
     public:
         // Default isometric tile dimensions
@@ -56,11 +63,83 @@ namespace Engine {
         Result<void> Initialize(int windowWidth, int windowHeight);
         bool IsInitialized() const { return m_initialized; }
         
+        /// Read-only view of the tile array. No bounds checks: callers
+        /// index only positions they already know are on the map. Valid for
+        /// the map's lifetime (the array is never resized).
+        struct TileView {
+            const Tile* tiles = nullptr;
+            uint16_t width = 0;
+            uint16_t height = 0;
+
+            const Tile& At(uint16_t row, uint16_t col) const { return tiles[static_cast<size_t>(row) * width + col]; }
+            const Tile* Row(uint16_t row) const { return tiles + static_cast<size_t>(row) * width; }
+            size_t Size() const { return static_cast<size_t>(width) * height; }
+        };
+
+        /// Walkability plane: one bit per tile (1 = walkable), each row
+        /// padded to whole 64-bit words so rows start word-aligned and
+        /// padding bits are 0. words is null while the plane is disabled.
+        /// No bounds checks.
+        struct WalkabilityView {
+            const uint64_t* words = nullptr;
+            size_t wordsPerRow = 0;
+            uint16_t width = 0;
+            uint16_t height = 0;
+
+            bool IsWalkable(uint16_t row, uint16_t col) const {
+                return ((words[static_cast<size_t>(row) * wordsPerRow + (col >> 6)] >> (col & 63)) & 1u) != 0;
+            }
+            const uint64_t* Row(uint16_t row) const { return words + static_cast<size_t>(row) * wordsPerRow; }
+        };
+
         // Tile access
-        Tile* GetTile(uint16_t row, uint16_t col);
-        const Tile* GetTile(uint16_t row, uint16_t col) const;
+        Tile* GetTile(uint16_t row, uint16_t col) {
+            if (row >= m_mapHeight || col >= m_mapWidth) {
+                return nullptr;
+            }
+            return &m_tiles[static_cast<size_t>(row) * m_mapWidth + col];
+        }
+        const Tile* GetTile(uint16_t row, uint16_t col) const {
+            if (row >= m_mapHeight || col >= m_mapWidth) {
+                return nullptr;
+            }
+            return &m_tiles[static_cast<size_t>(row) * m_mapWidth + col];
+        }
         Tile* GetTile(const TilePosition& pos) { return GetTile(pos.row, pos.col); }
         const Tile* GetTile(const TilePosition& pos) const { return GetTile(pos.row, pos.col); }
+
+        // Tile edits that notify listeners. Each returns false for an
+        // out-of-range tile and only notifies when the value really changes.
+        bool SetTileWalkable(uint16_t row, uint16_t col, bool walkable);
+        bool SetTileId(uint16_t row, uint16_t col, uint16_t id);
+
+        /// Notify listeners after editing a tile through GetTile() directly.
+        /// Also refreshes the tile's walkability bit first.
+        void NotifyTileChanged(uint16_t row, uint16_t col);
+
+        TileView GetTileView() const { return TileView{ m_tiles.data(), m_mapWidth, m_mapHeight }; }
+
+        /// Build (or drop) the walkability plane. Enabling copies the
+        /// current tiles; afterwards SetTileWalkable and NotifyTileChanged
+        /// keep it in step. Bulk edits through GetTile() without notifying
+        /// need RebuildWalkabilityPlane().
+        void SetWalkabilityPlaneEnabled(bool enabled);
+        bool HasWalkabilityPlane() const { return !m_walkableBits.empty(); }
+        void RebuildWalkabilityPlane();
+        WalkabilityView GetWalkabilityView() const;
+
+        /// Walkable tile count: popcount over the plane when it is enabled,
+        /// a tile scan otherwise.
+        size_t CountWalkableTiles() const;
+
+        /// Tile change listeners, called synchronously with the edited tile.
+        /// Caches derived from tile data (chunk textures, minimap, paths,
+        /// line of sight) subscribe so one edit only invalidates what it
+        /// touches. Listeners must not subscribe or unsubscribe while called.
+        using TileChangedHandler = std::function<void(const TilePosition&)>;
+        size_t SubscribeTileChanges(TileChangedHandler handler);
+        void UnsubscribeTileChanges(size_t subscriptionId);
+        size_t GetTileChangeSubscriberCount() const { return m_tileListeners.size(); }
         
         // Map properties
         uint16_t GetWidth() const { return m_mapWidth; }
@@ -85,13 +164,31 @@ namespace Engine {
         bool ScreenToTile(int screenX, int screenY, uint16_t& outRow, uint16_t& outCol, Camera2D* camera = nullptr) const;
         bool ScreenToTile(int screenX, int screenY, TilePosition& outPos, Camera2D* camera = nullptr) const;
 
+        /// Inclusive tile rectangle whose diamonds can overlap screenRect, solved
+        /// analytically from the isometric basis (no per-tile tests). Padded by
+        /// a tile for rounding. Returns false when no tile can be on screen.
+        bool GetTileRangeInRect(const Rect& screenRect,
+                                uint16_t& minRow, uint16_t& minCol,
+                                uint16_t& maxRow, uint16_t& maxCol,
+                                Camera2D* camera = nullptr) const;
+
     private:
         void ClampOffsetToBounds();
-        
+        void UpdateWalkableBit(uint16_t row, uint16_t col, bool walkable);
+
+        struct TileListener {
+            size_t id;
+            TileChangedHandler handler;
+        };
+
         ILogger* m_logger;
         
-        // Tile grid
-        std::vector<std::vector<Tile>> m_tiles;
+        // Tile grid, row-major
+        std::vector<Tile> m_tiles;
+
+        // Optional walkability plane (see WalkabilityView); empty = disabled
+        std::vector<uint64_t> m_walkableBits;
+        size_t m_walkableWordsPerRow = 0;
         
         // Map dimensions
         uint16_t m_mapWidth;
@@ -114,6 +211,9 @@ namespace Engine {
         // Camera offset for panning (legacy)
         int m_offsetX;
         int m_offsetY;
+
+        std::vector<TileListener> m_tileListeners;
+        size_t m_nextListenerId = 1;
         
         bool m_initialized;
     };
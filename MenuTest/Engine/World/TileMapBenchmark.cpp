@@ -0,0 +1,81 @@
+#include "../../Tests/SimpleTest.h"
+#include "TileMap.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace Engine;
+using namespace SimpleTest;
+
+TEST_CASE(TileMapBench_FullMapWalkableScan_512x512) {
+    const uint16_t size = 512;
+    const int scans = 20;
+    TileMap map(size, size);
+    for (uint16_t r = 0; r < size; ++r) {
+        for (uint16_t c = 0; c < size; ++c) {
+            if ((r * 7 + c * 3) % 5 == 0) map.GetTile(r, c)->SetWalkable(false);
+        }
+    }
+
+    // Before: one heap row per map row, bounds-checked lookups
+    std::vector<std::vector<Tile>> nested(size, std::vector<Tile>(size));
+    for (uint16_t r = 0; r < size; ++r) {
+        for (uint16_t c = 0; c < size; ++c) nested[r][c] = *map.GetTile(r, c);
+    }
+    auto nestedAt = [&](uint16_t r, uint16_t c) -> const Tile* {
+        if (r >= nested.size() || c >= nested[r].size()) return nullptr;
+        return &nested[r][c];
+    };
+
+    size_t nestedCount = 0, getTileCount = 0, viewCount = 0, planeCount = 0;
+    auto t0 = std::chrono::high_resolution_clock::now();
+    for (int s = 0; s < scans; ++s) {
+        nestedCount = 0;
+        for (uint16_t r = 0; r < size; ++r) {
+            for (uint16_t c = 0; c < size; ++c) {
+                const Tile* tile = nestedAt(r, c);
+                nestedCount += (tile && tile->IsWalkable()) ? 1 : 0;
+            }
+        }
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (int s = 0; s < scans; ++s) {
+        getTileCount = 0;
+        for (uint16_t r = 0; r < size; ++r) {
+            for (uint16_t c = 0; c < size; ++c) {
+                const Tile* tile = map.GetTile(r, c);
+                getTileCount += (tile && tile->IsWalkable()) ? 1 : 0;
+            }
+        }
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    TileMap::TileView view = map.GetTileView();
+    for (int s = 0; s < scans; ++s) {
+        viewCount = 0;
+        for (uint16_t r = 0; r < view.height; ++r) {
+            const Tile* line = view.Row(r);
+            for (uint16_t c = 0; c < view.width; ++c) viewCount += line[c].IsWalkable() ? 1 : 0;
+        }
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+    map.SetWalkabilityPlaneEnabled(true);
+    auto t4 = std::chrono::high_resolution_clock::now();
+    for (int s = 0; s < scans; ++s) {
+        planeCount = map.CountWalkableTiles();
+    }
+    auto t5 = std::chrono::high_resolution_clock::now();
+
+    auto us = [scans](std::chrono::high_resolution_clock::time_point a, std::chrono::high_resolution_clock::time_point b) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count() / 1000.0 / scans;
+    };
+    std::cout << "  [bench] Walkable scan 512x512: nested vectors " << us(t0, t1) << " us, flat GetTile "
+              << us(t1, t2) << " us, TileView " << us(t2, t3) << " us, bit plane " << us(t4, t5)
+              << " us (plane build " << us(t3, t4) * scans << " us, "
+              << (map.GetWalkabilityView().wordsPerRow * size * 8) / 1024 << " KB vs "
+              << (view.Size() * sizeof(Tile)) / 1024 << " KB tiles)" << std::endl;
+
+    ASSERT_EQUAL(getTileCount, nestedCount);
+    ASSERT_EQUAL(viewCount, nestedCount);
+    ASSERT_EQUAL(planeCount, nestedCount);
+    return TestResult{__FUNCTION__, true, ""};
+}
@@ -6,13 +6,12 @@
 #include "../Core/Logger/ILogger.h"
 #include <SDL3/SDL.h>
 #include <algorithm>
+#include <cmath>
 
 namespace Engine {
 
     TileMapRenderer::TileMapRenderer(ILogger* logger)
         : m_logger(logger)
-        , m_chunksPerRow(0)
-        , m_chunksPerCol(0)
         , m_windowCenter(0, 0)
         , m_mapSizeWidth(0)
         , m_mapSizeHeight(0)
@@ -35,15 +34,35 @@ namespace Engine {
         m_mapRenderRect.w = m_mapSizeWidth;
         m_mapRenderRect.h = m_mapSizeHeight;
 
+        // Re-initialising: hand the old chunk textures to the pool
+        for (auto& level : m_levels) {
+            for (auto& chunk : level.chunks) {
+                if (chunk.texture) {
+                    m_texturePool.Release(std::move(chunk.texture));
+                }
+            }
+            level.chunks.clear();
+        }
+        m_lodTextureBytes = 0;
+        m_chunkTextureBytes = 0;
+        m_hasLastView = false;
+        m_velocityX = 0.0f;
+        m_velocityY = 0.0f;
+
         // Compute chunk grid dimensions
-        m_chunksPerRow = (map.GetWidth() + CHUNK_SIZE - 1) / CHUNK_SIZE;
-        m_chunksPerCol = (map.GetHeight() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        LodLevel& base = m_levels[0];
+        base.chunksPerRow = (map.GetWidth() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+        base.chunksPerCol = (map.GetHeight() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+
+        base.chunks.resize(static_cast<size_t>(base.chunksPerRow) * base.chunksPerCol);
 
-        m_chunks.resize(static_cast<size_t>(m_chunksPerRow) * m_chunksPerCol);
+        m_tileWidth = map.GetTileWidth();
+        m_tileHeight = map.GetTileHeight();
+        m_localOriginY = map.GetWidth() * map.GetTileHeight();
 
         // Pre-calculate each chunk's local rect (bounding box within full map space)
-        for (uint16_t cr = 0; cr < m_chunksPerCol; ++cr) {
-            for (uint16_t cc = 0; cc < m_chunksPerRow; ++cc) {
+        for (uint16_t cr = 0; cr < base.chunksPerCol; ++cr) {
+            for (uint16_t cc = 0; cc < base.chunksPerRow; ++cc) {
                 uint16_t tileRowStart = cr * CHUNK_SIZE;
                 uint16_t tileColStart = cc * CHUNK_SIZE;
                 uint16_t tileRowEnd = std::min<uint16_t>(tileRowStart + CHUNK_SIZE, map.GetHeight());
@@ -67,25 +86,234 @@ namespace Engine {
                     }
                 }
 
-                auto& chunk = m_chunks[static_cast<size_t>(cr) * m_chunksPerRow + cc];
+                auto& chunk = base.chunks[static_cast<size_t>(cr) * base.chunksPerRow + cc];
                 chunk.localRect = Rect(minX, minY, maxX - minX, maxY - minY);
                 chunk.dirty = true;
             }
         }
 
+        // Each LOD level's rects are the union of its 2x2 children one level down
+        for (int level = 1; level <= MAX_LOD_LEVEL; ++level) {
+            const LodLevel& fine = m_levels[level - 1];
+            LodLevel& coarse = m_levels[level];
+            coarse.chunksPerRow = (fine.chunksPerRow + 1) / 2;
+            coarse.chunksPerCol = (fine.chunksPerCol + 1) / 2;
+            coarse.chunks.resize(static_cast<size_t>(coarse.chunksPerRow) * coarse.chunksPerCol);
+
+            for (uint16_t cr = 0; cr < coarse.chunksPerCol; ++cr) {
+                for (uint16_t cc = 0; cc < coarse.chunksPerRow; ++cc) {
+                    int minX = INT32_MAX, minY = INT32_MAX;
+                    int maxX = INT32_MIN, maxY = INT32_MIN;
+                    for (int fr = cr * 2; fr < std::min<int>(cr * 2 + 2, fine.chunksPerCol); ++fr) {
+                        for (int fc = cc * 2; fc < std::min<int>(cc * 2 + 2, fine.chunksPerRow); ++fc) {
+                            const Rect& r = fine.chunks[static_cast<size_t>(fr) * fine.chunksPerRow + fc].localRect;
+                            minX = std::min(minX, r.x);
+                            minY = std::min(minY, r.y);
+                            maxX = std::max(maxX, r.x + r.w);
+                            maxY = std::max(maxY, r.y + r.h);
+                        }
+                    }
+                    auto& chunk = coarse.chunks[static_cast<size_t>(cr) * coarse.chunksPerRow + cc];
+                    chunk.localRect = Rect(minX, minY, maxX - minX, maxY - minY);
+                    chunk.dirty = true;
+                }
+            }
+        }
+
         m_initialized = true;
 
         if (m_logger) {
             m_logger->Debug("TileMapRenderer initialized (" +
-                           std::to_string(m_chunksPerRow) + "x" +
-                           std::to_string(m_chunksPerCol) + " chunks)");
+                           std::to_string(base.chunksPerRow) + "x" +
+                           std::to_string(base.chunksPerCol) + " chunks)");
         }
     }
 
     void TileMapRenderer::Render(IRenderer* renderer, const TileMap& map, Camera2D* camera) {
         if (!m_initialized || !renderer) return;
 
-        // Determine the viewport rect in map-local space
+        Rect viewport = GetViewportLocalRect(map, camera);
+        int level = (camera && m_lodEnabled) ? SelectLodLevel(camera->GetZoom()) : 0;
+        LodLevel& lod = m_levels[level];
+        ++m_frameIndex;
+
+        m_frameStats = FrameStats{};
+        m_frameStats.lodLevel = level;
+        m_regenCandidates.clear();
+        m_frameStats.chunksTested = CollectVisibleChunks(viewport, m_visibleChunks, level);
+
+        // Queue dirty chunks by distance from the screen centre
+        for (size_t idx : m_visibleChunks) {
+            const Chunk& chunk = lod.chunks[idx];
+            if (chunk.dirty || !chunk.texture) {
+                Rect dest = GetChunkDestRect(chunk, map, camera);
+                long long dx = dest.x + dest.w / 2 - m_windowCenter.x;
+                long long dy = dest.y + dest.h / 2 - m_windowCenter.y;
+                m_regenCandidates.push_back(RegenCandidate{idx, !chunk.texture, dx * dx + dy * dy});
+            }
+        }
+        m_frameStats.visibleChunks = m_visibleChunks.size();
+
+        size_t regenCount = SelectRegenerations(m_regenCandidates, m_regenBudget);
+        for (size_t i = 0; i < regenCount; ++i) {
+            RegenerateChunk(renderer, map, level, m_regenCandidates[i].chunkIndex);
+        }
+        m_frameStats.regenerated = regenCount;
+        m_frameStats.deferred = m_regenCandidates.size() - regenCount;
+
+        for (size_t idx : m_visibleChunks) {
+            Chunk& chunk = lod.chunks[idx];
+            if (!chunk.texture) continue;
+
+            Rect destRect = GetChunkDestRect(chunk, map, camera);
+            Rect srcRect(0, 0, chunk.texture->GetWidth(), chunk.texture->GetHeight());
+            chunk.texture->Render(renderer, destRect, &srcRect);
+            chunk.lastDrawnFrame = m_frameIndex;
+            ++m_frameStats.drawn;
+        }
+
+        // Spare bake budget goes to chunks the camera is heading towards
+        UpdateViewportVelocity(viewport);
+        Rect prefetchRect = GetPrefetchRect(viewport, m_velocityX, m_velocityY, PREFETCH_LOOKAHEAD_FRAMES);
+        if (m_prefetchBudget > regenCount) {
+            PrefetchChunks(renderer, map, level, prefetchRect, m_prefetchBudget - regenCount);
+        }
+
+        EvictChunkTextures(prefetchRect);
+        EvictLodTextures(level);
+    }
+
+    Rect TileMapRenderer::GetPrefetchRect(const Rect& viewport, float velocityX, float velocityY, int lookaheadFrames) {
+        int aheadX = static_cast<int>(velocityX * lookaheadFrames);
+        int aheadY = static_cast<int>(velocityY * lookaheadFrames);
+        int marginX = viewport.w / 4;
+        int marginY = viewport.h / 4;
+
+        int minX = std::min(viewport.x, viewport.x + aheadX) - marginX;
+        int minY = std::min(viewport.y, viewport.y + aheadY) - marginY;
+        int maxX = std::max(viewport.x, viewport.x + aheadX) + viewport.w + marginX;
+        int maxY = std::max(viewport.y, viewport.y + aheadY) + viewport.h + marginY;
+        return Rect(minX, minY, maxX - minX, maxY - minY);
+    }
+
+    void TileMapRenderer::UpdateViewportVelocity(const Rect& viewport) {
+        Point center(viewport.x + viewport.w / 2, viewport.y + viewport.h / 2);
+        if (m_hasLastView) {
+            // Exponential smoothing so one jittery frame does not swing the ring
+            const float blend = 0.3f;
+            m_velocityX += (static_cast<float>(center.x - m_lastViewCenter.x) - m_velocityX) * blend;
+            m_velocityY += (static_cast<float>(center.y - m_lastViewCenter.y) - m_velocityY) * blend;
+        }
+        m_lastViewCenter = center;
+        m_hasLastView = true;
+    }
+
+    void TileMapRenderer::PrefetchChunks(IRenderer* renderer, const TileMap& map, int level,
+                                         const Rect& prefetchRect, size_t budget) {
+        LodLevel& lod = m_levels[level];
+        CollectVisibleChunks(prefetchRect, m_prefetchChunks, level);
+
+        // Nearest the predicted view first; on-screen chunks were handled already
+        long long aheadX = m_lastViewCenter.x + static_cast<long long>(m_velocityX * PREFETCH_LOOKAHEAD_FRAMES);
+        long long aheadY = m_lastViewCenter.y + static_cast<long long>(m_velocityY * PREFETCH_LOOKAHEAD_FRAMES);
+        m_prefetchCandidates.clear();
+        for (size_t idx : m_prefetchChunks) {
+            const Chunk& chunk = lod.chunks[idx];
+            if (chunk.lastDrawnFrame == m_frameIndex) continue;
+            if (chunk.texture && !chunk.dirty) continue;
+            long long dx = chunk.localRect.x + chunk.localRect.w / 2 - aheadX;
+            long long dy = chunk.localRect.y + chunk.localRect.h / 2 - aheadY;
+            m_prefetchCandidates.push_back(RegenCandidate{idx, !chunk.texture, dx * dx + dy * dy});
+        }
+
+        size_t count = std::min(budget, m_prefetchCandidates.size());
+        std::partial_sort(m_prefetchCandidates.begin(), m_prefetchCandidates.begin() + count, m_prefetchCandidates.end(),
+                          [](const RegenCandidate& a, const RegenCandidate& b) { return a.distanceSq < b.distanceSq; });
+        for (size_t i = 0; i < count; ++i) {
+            RegenerateChunk(renderer, map, level, m_prefetchCandidates[i].chunkIndex);
+        }
+        m_frameStats.prefetched = count;
+    }
+
+    void TileMapRenderer::EvictChunkTextures(const Rect& keepRect) {
+        if (m_chunkMemoryBudget == 0 || m_chunkTextureBytes <= m_chunkMemoryBudget) return;
+
+        // Farthest from the view first; this frame's chunks and the
+        // prefetch ring are kept. Destroyed rather than pooled, like LOD eviction
+        long long centerX = keepRect.x + keepRect.w / 2;
+        long long centerY = keepRect.y + keepRect.h / 2;
+        m_evictionOrder.clear();
+        const auto& chunks = m_levels[0].chunks;
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const Chunk& chunk = chunks[i];
+            if (!chunk.texture || chunk.lastDrawnFrame == m_frameIndex || IsChunkVisible(chunk, keepRect)) continue;
+            long long dx = chunk.localRect.x + chunk.localRect.w / 2 - centerX;
+            long long dy = chunk.localRect.y + chunk.localRect.h / 2 - centerY;
+            m_evictionOrder.push_back(EvictionCandidate{static_cast<uint64_t>(dx * dx + dy * dy), 0, i});
+        }
+        std::sort(m_evictionOrder.begin(), m_evictionOrder.end(),
+                  [](const EvictionCandidate& a, const EvictionCandidate& b) { return a.order > b.order; });
+
+        for (const EvictionCandidate& candidate : m_evictionOrder) {
+            if (m_chunkTextureBytes <= m_chunkMemoryBudget) break;
+            Chunk& chunk = m_levels[0].chunks[candidate.index];
+            m_chunkTextureBytes -= GetTextureBytes(*chunk.texture);
+            chunk.texture.reset();
+            ++m_frameStats.evicted;
+        }
+    }
+
+    int TileMapRenderer::SelectLodLevel(float zoom) {
+        int level = 0;
+        float threshold = LOD_ZOOM_THRESHOLD;
+        while (level < MAX_LOD_LEVEL && zoom < threshold) {
+            ++level;
+            threshold *= 0.5f;
+        }
+        return level;
+    }
+
+    int TileMapRenderer::GetBakedExtent(int localExtent, int level) {
+        int scale = 1 << level;
+        return (localExtent + scale - 1) / scale;
+    }
+
+    void TileMapRenderer::ReleaseChunkTexture(Chunk& chunk, int level) {
+        if (!chunk.texture) return;
+        TextureBytes(level) -= GetTextureBytes(*chunk.texture);
+        m_texturePool.Release(std::move(chunk.texture));
+        chunk.texture.reset();
+    }
+
+    void TileMapRenderer::EvictLodTextures(int drawnLevel) {
+        if (m_lodTextureBytes <= m_lodMemoryBudget) return;
+
+        // Key: other levels go first, then least recently drawn; chunks drawn this
+        // frame stay. Evicted textures are destroyed, not pooled, so the
+        // memory is actually freed
+        m_evictionOrder.clear();
+        for (int level = 1; level <= MAX_LOD_LEVEL; ++level) {
+            const auto& chunks = m_levels[level].chunks;
+            uint64_t rank = (level == drawnLevel) ? (1ull << 63) : 0;
+            for (size_t i = 0; i < chunks.size(); ++i) {
+                if (chunks[i].texture && chunks[i].lastDrawnFrame != m_frameIndex) {
+                    m_evictionOrder.push_back(EvictionCandidate{rank | chunks[i].lastDrawnFrame, level, i});
+                }
+            }
+        }
+        std::sort(m_evictionOrder.begin(), m_evictionOrder.end(),
+                  [](const EvictionCandidate& a, const EvictionCandidate& b) { return a.order < b.order; });
+
+        for (const EvictionCandidate& candidate : m_evictionOrder) {
+            if (m_lodTextureBytes <= m_lodMemoryBudget) break;
+            Chunk& chunk = m_levels[candidate.level].chunks[candidate.index];
+            m_lodTextureBytes -= GetTextureBytes(*chunk.texture);
+            chunk.texture.reset();
+            ++m_frameStats.lodEvicted;
+        }
+    }
+
+    Rect TileMapRenderer::GetViewportLocalRect(const TileMap& map, Camera2D* camera) const {
         Rect viewport;
         if (camera) {
             // Screen (0,0) → world, then offset into map-local space
@@ -105,114 +333,162 @@ namespace Engine {
             viewport.w = m_windowCenter.x * 2;
             viewport.h = m_windowCenter.y * 2;
         }
+        return viewport;
+    }
 
-        for (uint16_t cr = 0; cr < m_chunksPerCol; ++cr) {
-            for (uint16_t cc = 0; cc < m_chunksPerRow; ++cc) {
-                size_t idx = static_cast<size_t>(cr) * m_chunksPerRow + cc;
-                Chunk& chunk = m_chunks[idx];
-
-                // Viewport culling
-                if (!IsChunkVisible(chunk, viewport)) continue;
-
-                // Regenerate if dirty
-                if (chunk.dirty || !chunk.texture) {
-                    RegenerateChunk(renderer, map, cr, cc);
-                }
-
-                if (!chunk.texture) continue;
-
-                // Calculate screen position for this chunk
-                Rect destRect;
-                if (camera) {
-                    int worldX = chunk.localRect.x - m_mapSizeWidth / 2;
-                    int worldY = chunk.localRect.y - m_mapSizeHeight / 2;
-                    Point screenPos = camera->WorldToScreen(Point(worldX, worldY));
-                    destRect.x = screenPos.x;
-                    destRect.y = screenPos.y;
-                    // Scale chunk size by camera zoom
-                    float zoom = camera->GetZoom();
-                    destRect.w = static_cast<int>(chunk.localRect.w * zoom);
-                    destRect.h = static_cast<int>(chunk.localRect.h * zoom);
-                } else {
-                    Point offset = map.GetOffset();
-                    destRect.x = chunk.localRect.x + m_mapRenderRect.x + offset.x;
-                    destRect.y = chunk.localRect.y + m_mapRenderRect.y + offset.y;
-                    destRect.w = chunk.localRect.w;
-                    destRect.h = chunk.localRect.h;
+    size_t TileMapRenderer::CollectVisibleChunks(const Rect& viewport, std::vector<size_t>& out, int level) const {
+        out.clear();
+        const LodLevel& lod = m_levels[level];
+        if (lod.chunks.empty() || m_tileWidth == 0 || m_tileHeight == 0) return 0;
+
+        // Inverse-project the viewport into lattice units: u = col + row runs
+        // along screen x, v = col - row up screen y (see IsometricMath::TileToLocal)
+        const double size = static_cast<double>(CHUNK_SIZE << level);
+        double u0 = static_cast<double>(viewport.x) / m_tileWidth;
+        double u1 = static_cast<double>(viewport.x + viewport.w) / m_tileWidth;
+        double v0 = static_cast<double>(m_localOriginY - (viewport.y + viewport.h)) / m_tileHeight;
+        double v1 = static_cast<double>(m_localOriginY - viewport.y) / m_tileHeight;
+
+        // A full chunk (cr, cc) spans u in [(cr+cc)S, (cr+cc+2)S] and v in
+        // [(cc-cr-1)S, (cc-cr+1)S], so its bounds meet the viewport when
+        // a = cr + cc and b = cc - cr fall in these ranges. Rounding outward
+        // keeps the range a superset; the bounds test below trims corners
+        double aMin = u0 / size - 2.0, aMax = u1 / size;
+        double bMin = v0 / size - 1.0, bMax = v1 / size + 1.0;
+
+        int lastRow = static_cast<int>(lod.chunksPerCol) - 1;
+        int lastCol = static_cast<int>(lod.chunksPerRow) - 1;
+        int rowBegin = std::max(0, static_cast<int>(std::floor((aMin - bMax) / 2.0)));
+        int rowEnd = std::min(lastRow, static_cast<int>(std::ceil((aMax - bMin) / 2.0)));
+
+        size_t tested = 0;
+        for (int cr = rowBegin; cr <= rowEnd; ++cr) {
+            int colBegin = std::max(0, static_cast<int>(std::floor(std::max(aMin - cr, bMin + cr))));
+            int colEnd = std::min(lastCol, static_cast<int>(std::ceil(std::min(aMax - cr, bMax + cr))));
+            for (int cc = colBegin; cc <= colEnd; ++cc) {
+                size_t idx = static_cast<size_t>(cr) * lod.chunksPerRow + cc;
+                ++tested;
+                if (IsChunkVisible(lod.chunks[idx], viewport)) {
+                    out.push_back(idx);
                 }
-
-                Rect srcRect(0, 0, chunk.localRect.w, chunk.localRect.h);
-                chunk.texture->Render(renderer, destRect, &srcRect);
             }
         }
+        return tested;
+    }
+
+    Rect TileMapRenderer::GetChunkDestRect(const Chunk& chunk, const TileMap& map, Camera2D* camera) const {
+        // Calculate screen position for this chunk
+        Rect destRect;
+        if (camera) {
+            int worldX = chunk.localRect.x - m_mapSizeWidth / 2;
+            int worldY = chunk.localRect.y - m_mapSizeHeight / 2;
+            Point screenPos = camera->WorldToScreen(Point(worldX, worldY));
+            destRect.x = screenPos.x;
+            destRect.y = screenPos.y;
+            // Scale chunk size by camera zoom
+            float zoom = camera->GetZoom();
+            destRect.w = static_cast<int>(chunk.localRect.w * zoom);
+            destRect.h = static_cast<int>(chunk.localRect.h * zoom);
+        } else {
+            Point offset = map.GetOffset();
+            destRect.x = chunk.localRect.x + m_mapRenderRect.x + offset.x;
+            destRect.y = chunk.localRect.y + m_mapRenderRect.y + offset.y;
+            destRect.w = chunk.localRect.w;
+            destRect.h = chunk.localRect.h;
+        }
+        return destRect;
+    }
+
+    size_t TileMapRenderer::SelectRegenerations(std::vector<RegenCandidate>& candidates, size_t budget) {
+        std::sort(candidates.begin(), candidates.end(), [](const RegenCandidate& a, const RegenCandidate& b) {
+            if (a.missing != b.missing) return a.missing;
+            if (a.distanceSq != b.distanceSq) return a.distanceSq < b.distanceSq;
+            return a.chunkIndex < b.chunkIndex;
+        });
+
+        size_t missing = 0;
+        while (missing < candidates.size() && candidates[missing].missing) ++missing;
+        size_t stale = candidates.size() - missing;
+        if (budget != 0 && stale > budget) stale = budget;
+        return missing + stale;
     }
 
     void TileMapRenderer::InvalidateChunk(uint16_t chunkRow, uint16_t chunkCol) {
-        size_t idx = static_cast<size_t>(chunkRow) * m_chunksPerRow + chunkCol;
-        if (idx < m_chunks.size()) {
-            m_chunks[idx].dirty = true;
+        if (chunkRow >= m_levels[0].chunksPerCol || chunkCol >= m_levels[0].chunksPerRow) return;
+        for (int level = 0; level <= MAX_LOD_LEVEL; ++level) {
+            LodLevel& lod = m_levels[level];
+            size_t idx = static_cast<size_t>(chunkRow >> level) * lod.chunksPerRow + (chunkCol >> level);
+            if (idx < lod.chunks.size()) {
+                lod.chunks[idx].dirty = true;
+            }
         }
     }
 
     void TileMapRenderer::Invalidate() {
-        for (auto& chunk : m_chunks) {
-            chunk.dirty = true;
+        for (auto& level : m_levels) {
+            for (auto& chunk : level.chunks) {
+                chunk.dirty = true;
+            }
         }
     }
 
-    void TileMapRenderer::RegenerateChunk(IRenderer* renderer, const TileMap& map,
-                                           uint16_t chunkRow, uint16_t chunkCol) {
-        size_t idx = static_cast<size_t>(chunkRow) * m_chunksPerRow + chunkCol;
-        Chunk& chunk = m_chunks[idx];
+    void TileMapRenderer::RegenerateChunk(IRenderer* renderer, const TileMap& map, int level, size_t index) {
+        LodLevel& lod = m_levels[level];
+        Chunk& chunk = lod.chunks[index];
 
         SDL_Renderer* sdlRenderer = renderer->GetNativeRenderer();
         if (!sdlRenderer) return;
 
-        int texW = chunk.localRect.w;
-        int texH = chunk.localRect.h;
+        // Super-chunks bake at 1 / 2^level of their map-local size
+        int texW = GetBakedExtent(chunk.localRect.w, level);
+        int texH = GetBakedExtent(chunk.localRect.h, level);
         if (texW <= 0 || texH <= 0) return;
 
-        SDL_Texture* targetTexture = SDL_CreateTexture(
-            sdlRenderer, SDL_PIXELFORMAT_RGBA8888,
-            SDL_TEXTUREACCESS_TARGET, texW, texH);
-
-        if (!targetTexture) {
-            if (m_logger) {
-                m_logger->Error("Failed to create chunk texture: " + std::string(SDL_GetError()));
+        // Re-render in place when the size still fits, otherwise swap through the pool
+        std::shared_ptr<Texture> target = chunk.texture;
+        if (!target || target->GetWidth() != texW || target->GetHeight() != texH) {
+            ReleaseChunkTexture(chunk, level);
+            target = m_texturePool.Acquire(renderer, texW, texH);
+            if (!target) {
+                if (m_logger) {
+                    m_logger->Error("Failed to create chunk texture: " + std::string(SDL_GetError()));
+                }
+                return;
             }
-            return;
+            chunk.texture = target;
+            TextureBytes(level) += GetTextureBytes(*target);
         }
+        SDL_Texture* targetTexture = target->GetSDLTexture();
 
-        SDL_SetTextureBlendMode(targetTexture, SDL_BLENDMODE_BLEND);
         SDL_SetRenderTarget(sdlRenderer, targetTexture);
         SDL_SetRenderDrawColor(sdlRenderer, 0, 0, 0, 0);
         SDL_RenderClear(sdlRenderer);
+        if (level > 0) {
+            float scale = 1.0f / static_cast<float>(1 << level);
+            SDL_SetRenderScale(sdlRenderer, scale, scale);
+        }
 
         uint16_t originX = 0;
         uint16_t originY = map.GetWidth() * map.GetTileHeight();
 
-        uint16_t tileRowStart = chunkRow * CHUNK_SIZE;
-        uint16_t tileColStart = chunkCol * CHUNK_SIZE;
-        uint16_t tileRowEnd = std::min<uint16_t>(tileRowStart + CHUNK_SIZE, map.GetHeight());
-        uint16_t tileColEnd = std::min<uint16_t>(tileColStart + CHUNK_SIZE, map.GetWidth());
-
-        for (uint16_t r = tileRowStart; r < tileRowEnd; ++r) {
-            for (uint16_t c = tileColStart; c < tileColEnd; ++c) {
-                Point tilePos = IsometricMath::TileToLocal(r, c, originX, originY,
-                                                           map.GetTileWidth(), map.GetTileHeight());
-                // Offset into chunk-local coordinates
-                Point localPos(tilePos.x - chunk.localRect.x, tilePos.y - chunk.localRect.y);
-
-                const Tile* tile = map.GetTile(r, c);
-                if (tile) {
-                    tile->Render(renderer, localPos, map.GetTileWidth(), map.GetTileHeight());
-                }
-            }
+        int span = CHUNK_SIZE << level;
+        int tileRowStart = static_cast<int>(index / lod.chunksPerRow) * span;
+        int tileColStart = static_cast<int>(index % lod.chunksPerRow) * span;
+        int tileRowEnd = std::min<int>(tileRowStart + span, map.GetHeight());
+        int tileColEnd = std::min<int>(tileColStart + span, map.GetWidth());
+
+        // All fills in one geometry batch, all outlines in two line strips
+        Point first = IsometricMath::TileToLocal(static_cast<uint16_t>(tileRowStart), static_cast<uint16_t>(tileColStart),
+                                                 originX, originY, map.GetTileWidth(), map.GetTileHeight());
+        SDL_FPoint origin{ static_cast<float>(first.x - chunk.localRect.x),
+                           static_cast<float>(first.y - chunk.localRect.y) };
+        m_baker.Build(map, tileRowStart, tileColStart, tileRowEnd, tileColEnd, origin);
+        m_baker.Draw(sdlRenderer);
+
+        if (level > 0) {
+            SDL_SetRenderScale(sdlRenderer, 1.0f, 1.0f);
         }
-
         SDL_SetRenderTarget(sdlRenderer, nullptr);
-
-        chunk.texture = Texture::CreateFromSDL(targetTexture, texW, texH);
         chunk.dirty = false;
     }
 
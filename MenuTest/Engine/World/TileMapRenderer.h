@@ -2,6 +2,8 @@
 
 #include "../Core/Types.h"
 #include "../Graphics/Texture.h"
+#include "../Graphics/RenderTargetPool.h"
+#include "TileBatchBaker.h"
 #include <memory>
 #include <vector>
 
@@ -15,9 +17,74 @@ namespace Engine {
     /// Handles rendering of a TileMap to screen using chunked texture caching.
     /// The map is divided into CHUNK_SIZE x CHUNK_SIZE tile chunks.
     /// Only dirty chunks are re-rendered; only visible chunks are drawn.
+    /// The visible set is solved from the viewport in lattice coordinates,
+    /// so a frame tests only the chunks near the screen, not the whole grid.
+    ///
+    /// Re-baking is budgeted: a dirty chunk that still has a texture keeps
+    /// drawing it (stale) until its turn comes, nearest the screen centre
+    /// first, at most GetRegenerationBudget() per frame. Chunks with no
+    /// texture yet are always baked, since there is nothing to show.
+    /// Chunk textures are re-rendered in place, and textures that change size
+    /// or are dropped go through a RenderTargetPool. A bake is a handful of
+    /// batched draws (TileBatchBaker), not per-tile calls.
+    ///
+    /// Zoomed out, chunks come from a coarser LOD level: level L merges
+    /// 2^L x 2^L base chunks into one super-chunk baked at 1/2^L resolution,
+    /// so draws and texture memory fall with zoom. Super-chunks are baked
+    /// only when first drawn and are evicted least recently drawn first
+    /// once they exceed the LOD memory budget.
+    ///
+    /// Frames that bake fewer chunks than the prefetch budget spend the rest
+    /// pre-baking off-screen chunks in a ring around the viewport, stretched
+    /// ahead along the viewport's recent velocity, so pans reveal chunks that
+    /// are already baked. Base chunk textures are capped by a memory budget;
+    /// over it, the chunks farthest from the view are dropped first.
+    ///
+    /// With a TileAtlas set, tiles with art bake as textured quads, one
+    /// batch per atlas page, instead of procedural diamonds.
     class TileMapRenderer {
     public:
         static constexpr uint16_t CHUNK_SIZE = 16; // tiles per chunk edge
+        static constexpr size_t DEFAULT_REGEN_BUDGET = 4; // stale re-bakes per frame
+        static constexpr int MAX_LOD_LEVEL = 2;    // 4x4 base chunks per super-chunk
+        static constexpr float LOD_ZOOM_THRESHOLD = 0.5f; // level 1 below this zoom, level 2 below half of it
+        static constexpr size_t DEFAULT_LOD_MEMORY_BUDGET = 64 * 1024 * 1024; // bytes
+        static constexpr size_t DEFAULT_PREFETCH_BUDGET = 2;      // chunk bakes per frame, including visible ones
+        static constexpr int PREFETCH_LOOKAHEAD_FRAMES = 20;      // how far ahead the ring is stretched
+        static constexpr size_t DEFAULT_CHUNK_MEMORY_BUDGET = 256 * 1024 * 1024; // bytes, base level
+
+        struct FrameStats {
+            size_t visibleChunks = 0;
+            size_t chunksTested = 0;  // Candidates from the analytic range
+            size_t regenerated = 0;   // Chunks baked this frame
+            size_t deferred = 0;      // Dirty chunks drawn stale this frame
+            size_t drawn = 0;
+            int lodLevel = 0;
+            size_t lodEvicted = 0;    // Super-chunk textures dropped for the budget
+            size_t prefetched = 0;    // Off-screen chunks baked ahead of time
+            size_t evicted = 0;       // Base chunk textures dropped for the budget
+        };
+
+        /// A chunk waiting to be baked, for SelectRegenerations.
+        struct RegenCandidate {
+            size_t chunkIndex;
+            bool missing;          // No texture at all
+            long long distanceSq;  // Chunk centre to screen centre, screen pixels
+        };
+
+        /// Order candidates (missing first, then nearest) and return how many
+        /// of the front ones to bake: all missing plus up to budget stale.
+        /// budget 0 = no limit.
+        static size_t SelectRegenerations(std::vector<RegenCandidate>& candidates, size_t budget);
+
+        /// LOD level for a camera zoom: 0 at or above LOD_ZOOM_THRESHOLD,
+        /// then one level per halving, up to MAX_LOD_LEVEL.
+        static int SelectLodLevel(float zoom);
+
+        /// Region worth having baked next: the viewport and where it will be
+        /// after lookaheadFrames at (velocityX, velocityY) px/frame, expanded
+        /// by a quarter viewport on every side. Map-local pixels.
+        static Rect GetPrefetchRect(const Rect& viewport, float velocityX, float velocityY, int lookaheadFrames);
 
         TileMapRenderer(ILogger* logger = nullptr);
         ~TileMapRenderer();
@@ -28,36 +95,140 @@ namespace Engine {
         /// Render the tilemap. Draws only chunks visible in the viewport.
         void Render(IRenderer* renderer, const TileMap& map, Camera2D* camera = nullptr);
 
-        /// Mark a specific chunk as dirty (e.g., after tile data changes).
+        /// Mark a specific chunk as dirty (e.g., after tile data changes),
+        /// along with the super-chunks that contain it.
         void InvalidateChunk(uint16_t chunkRow, uint16_t chunkCol);
 
+        /// Mark the chunk holding one tile as dirty. Suitable as a
+        /// TileMap::SubscribeTileChanges handler: one edit re-bakes one chunk.
+        void InvalidateTile(uint16_t row, uint16_t col) { InvalidateChunk(row / CHUNK_SIZE, col / CHUNK_SIZE); }
+
         /// Force all chunks to be regenerated.
         void Invalidate();
 
+        /// Bake tiles from an atlas (nullptr = procedural diamonds only).
+        /// Every chunk is re-baked. The atlas must outlive the renderer or
+        /// be unset first.
+        void SetTileAtlas(const TileAtlas* atlas) {
+            m_baker.SetAtlas(atlas);
+            Invalidate();
+        }
+        const TileAtlas* GetTileAtlas() const { return m_baker.GetAtlas(); }
+
+        /// Viewport in map-local pixels (the space of chunk rects).
+        Rect GetViewportLocalRect(const TileMap& map, Camera2D* camera) const;
+
+        /// Indices (chunkRow * chunksPerRow + chunkCol) of a level's chunks
+        /// whose bounds overlap a map-local viewport, in row-major order.
+        /// Returns the number of chunks tested to find them.
+        size_t CollectVisibleChunks(const Rect& viewport, std::vector<size_t>& out, int level = 0) const;
+
+        size_t GetChunkCount(int level = 0) const { return m_levels[level].chunks.size(); }
+        Rect GetChunkLocalRect(size_t index, int level = 0) const { return m_levels[level].chunks[index].localRect; }
+
         /// Get the map render rect (position/size on screen).
         Rect GetMapRenderRect() const { return m_mapRenderRect; }
 
+        /// Stale chunks re-baked per frame (0 = all at once).
+        void SetRegenerationBudget(size_t chunksPerFrame) { m_regenBudget = chunksPerFrame; }
+        size_t GetRegenerationBudget() const { return m_regenBudget; }
+
+        /// Use coarser levels when zoomed out (on by default).
+        void SetLodEnabled(bool enabled) { m_lodEnabled = enabled; }
+        bool IsLodEnabled() const { return m_lodEnabled; }
+
+        /// Texture bytes kept for super-chunks (levels above 0).
+        void SetLodMemoryBudget(size_t bytes) { m_lodMemoryBudget = bytes; }
+        size_t GetLodMemoryBudget() const { return m_lodMemoryBudget; }
+        size_t GetLodTextureBytes() const { return m_lodTextureBytes; }
+
+        /// Chunk bakes per frame, visible and prefetched together; prefetch
+        /// uses whatever the visible bakes leave. 0 disables prefetching.
+        void SetPrefetchBudget(size_t chunksPerFrame) { m_prefetchBudget = chunksPerFrame; }
+        size_t GetPrefetchBudget() const { return m_prefetchBudget; }
+
+        /// Texture bytes kept for base-level chunks (0 = no limit).
+        void SetChunkMemoryBudget(size_t bytes) { m_chunkMemoryBudget = bytes; }
+        size_t GetChunkMemoryBudget() const { return m_chunkMemoryBudget; }
+        size_t GetChunkTextureBytes() const { return m_chunkTextureBytes; }
+
+        /// Smoothed viewport motion, map-local px per frame.
+        float GetViewportVelocityX() const { return m_velocityX; }
+        float GetViewportVelocityY() const { return m_velocityY; }
+
+        const FrameStats& GetLastFrameStats() const { return m_frameStats; }
+        const RenderTargetPool& GetTexturePool() const { return m_texturePool; }
+
     private:
         struct Chunk {
             std::shared_ptr<Texture> texture;
             bool dirty = true;
             Rect localRect; // position within the full map texture space
+            uint64_t lastDrawnFrame = 0;
+        };
+
+        /// One chunk grid. Level L chunks span CHUNK_SIZE << L tiles and bake
+        /// at 1 / (1 << L) scale.
+        struct LodLevel {
+            std::vector<Chunk> chunks;
+            uint16_t chunksPerRow = 0;
+            uint16_t chunksPerCol = 0;
         };
 
-        void RegenerateChunk(IRenderer* renderer, const TileMap& map, uint16_t chunkRow, uint16_t chunkCol);
+        void RegenerateChunk(IRenderer* renderer, const TileMap& map, int level, size_t index);
         bool IsChunkVisible(const Chunk& chunk, const Rect& viewport) const;
+        Rect GetChunkDestRect(const Chunk& chunk, const TileMap& map, Camera2D* camera) const;
+        static int GetBakedExtent(int localExtent, int level);
+        static size_t GetTextureBytes(const Texture& texture) {
+            return static_cast<size_t>(texture.GetWidth()) * texture.GetHeight() * 4;  // RGBA8888
+        }
+        size_t& TextureBytes(int level) { return level > 0 ? m_lodTextureBytes : m_chunkTextureBytes; }
+        void ReleaseChunkTexture(Chunk& chunk, int level);
+        void EvictLodTextures(int drawnLevel);
+        void UpdateViewportVelocity(const Rect& viewport);
+        void PrefetchChunks(IRenderer* renderer, const TileMap& map, int level, const Rect& prefetchRect, size_t budget);
+        void EvictChunkTextures(const Rect& keepRect);
 
         ILogger* m_logger;
 
-        std::vector<Chunk> m_chunks;
-        uint16_t m_chunksPerRow;
-        uint16_t m_chunksPerCol;
+        LodLevel m_levels[MAX_LOD_LEVEL + 1];
 
         Rect m_mapRenderRect;
         Point m_windowCenter;
         uint16_t m_mapSizeWidth;
         uint16_t m_mapSizeHeight;
+        uint16_t m_tileWidth = 0;
+        uint16_t m_tileHeight = 0;
+        int m_localOriginY = 0;  // Map-local y of the row/col lattice origin
         bool m_initialized;
+
+        RenderTargetPool m_texturePool;
+        size_t m_regenBudget = DEFAULT_REGEN_BUDGET;
+        FrameStats m_frameStats;
+        std::vector<size_t> m_visibleChunks;           // Scratch, per frame
+        std::vector<RegenCandidate> m_regenCandidates; // Scratch, per frame
+        TileBatchBaker m_baker;                        // Reused by every bake
+
+        bool m_lodEnabled = true;
+        size_t m_lodMemoryBudget = DEFAULT_LOD_MEMORY_BUDGET;
+        size_t m_lodTextureBytes = 0;
+        uint64_t m_frameIndex = 0;
+        struct EvictionCandidate {
+            uint64_t order;  // Sort key; each evicting pass defines its own
+            int level;
+            size_t index;
+        };
+        std::vector<EvictionCandidate> m_evictionOrder;  // Scratch
+
+        size_t m_prefetchBudget = DEFAULT_PREFETCH_BUDGET;
+        size_t m_chunkMemoryBudget = DEFAULT_CHUNK_MEMORY_BUDGET;
+        size_t m_chunkTextureBytes = 0;
+        float m_velocityX = 0.0f;
+        float m_velocityY = 0.0f;
+        Point m_lastViewCenter;
+        bool m_hasLastView = false;
+        std::vector<size_t> m_prefetchChunks;            // Scratch, per frame
+        std::vector<RegenCandidate> m_prefetchCandidates; // Scratch, per frame
     };
 
 } // namespace Engine
@@ -0,0 +1,252 @@
+#include "../../Tests/SimpleTest.h"
+#include "TileMapRenderer.h"
+#include "TileMap.h"
+#include "../Camera/Camera2D.h"
+#include "../Graphics/RenderTargetPool.h"
+#include "../Core/Constants.h"
+#include "../Renderer/IRenderer.h"
+#include <algorithm>
+
+using namespace Engine;
+using namespace SimpleTest;
+
+TEST_CASE(TileMapRenderer_SelectRegenerations_MissingFirstThenNearest) {
+    std::vector<TileMapRenderer::RegenCandidate> candidates = {
+        {0, false, 900},
+        {1, false, 100},
+        {2, true, 5000},
+        {3, false, 400},
+        {4, true, 10},
+        {5, false, 50},
+    };
+    size_t count = TileMapRenderer::SelectRegenerations(candidates, 2);
+
+    // Both missing chunks plus the two nearest stale ones
+    ASSERT_EQUAL(count, (size_t)4);
+    ASSERT_EQUAL(candidates[0].chunkIndex, (size_t)4);
+    ASSERT_EQUAL(candidates[1].chunkIndex, (size_t)2);
+    ASSERT_EQUAL(candidates[2].chunkIndex, (size_t)5);
+    ASSERT_EQUAL(candidates[3].chunkIndex, (size_t)1);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileMapRenderer_SelectRegenerations_ZeroBudgetIsUnlimited) {
+    std::vector<TileMapRenderer::RegenCandidate> candidates;
+    for (size_t i = 0; i < 20; ++i) {
+        candidates.push_back({i, false, static_cast<long long>(100 - i)});
+    }
+    ASSERT_EQUAL(TileMapRenderer::SelectRegenerations(candidates, 0), (size_t)20);
+    ASSERT_EQUAL(candidates[0].chunkIndex, (size_t)19);
+    ASSERT_EQUAL(TileMapRenderer::SelectRegenerations(candidates, 4), (size_t)4);
+
+    std::vector<TileMapRenderer::RegenCandidate> none;
+    ASSERT_EQUAL(TileMapRenderer::SelectRegenerations(none, 4), (size_t)0);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(RenderTargetPool_MissWithoutRenderer_CountsAndReturnsNull) {
+    RenderTargetPool pool(4);
+    ASSERT_FLOAT_NEAR(pool.GetHitRate(), 0.0f, 0.0001f);
+    ASSERT_NULL(pool.Acquire(nullptr, 64, 64).get());
+    ASSERT_EQUAL(pool.GetMisses(), (size_t)1);
+    ASSERT_EQUAL(pool.GetHits(), (size_t)0);
+
+    pool.Release(nullptr);
+    ASSERT_EQUAL(pool.GetFreeCount(), (size_t)0);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+namespace {
+    std::vector<size_t> ScanVisibleChunks(const TileMapRenderer& renderer, const Rect& viewport, int level = 0) {
+        std::vector<size_t> visible;
+        for (size_t i = 0; i < renderer.GetChunkCount(level); ++i) {
+            Rect r = renderer.GetChunkLocalRect(i, level);
+            bool overlaps = !(r.x + r.w < viewport.x || r.x > viewport.x + viewport.w ||
+                              r.y + r.h < viewport.y || r.y > viewport.y + viewport.h);
+            if (overlaps) visible.push_back(i);
+        }
+        return visible;
+    }
+}
+
+TEST_CASE(TileMapRenderer_CollectVisibleChunks_MatchesFullScanAtEveryZoom) {
+    // Not a multiple of CHUNK_SIZE, so edge chunks are partial
+    TileMap map(200, 150);
+    ASSERT_TRUE(map.Initialize(800, 600).success);
+    TileMapRenderer renderer;
+    renderer.Initialize(800, 600, map);
+
+    Camera2D camera(800, 600);
+    Rect bounds = map.GetBounds();
+    const Point positions[] = {
+        {0, 0},
+        {-bounds.w / 2, 0}, {bounds.w / 2, 0},
+        {0, -bounds.h / 2}, {0, bounds.h / 2},
+        {bounds.w / 3, -bounds.h / 5},
+        {bounds.w, bounds.h},  // Off the map entirely
+    };
+
+    std::vector<size_t> visible;
+    size_t mismatches = 0;
+    size_t views = 0;
+    for (int step = 0; ; ++step) {
+        float zoom = Constants::Camera::MIN_ZOOM + 0.1f * step;
+        if (zoom > Constants::Camera::MAX_ZOOM + 0.001f) break;
+        camera.SetZoom(zoom);
+        for (const Point& pos : positions) {
+            camera.SetPosition(pos);
+            Rect viewport = renderer.GetViewportLocalRect(map, &camera);
+            renderer.CollectVisibleChunks(viewport, visible);
+            if (visible != ScanVisibleChunks(renderer, viewport)) ++mismatches;
+            ++views;
+        }
+    }
+    ASSERT_EQUAL(views, (size_t)(50 * 7));
+    ASSERT_EQUAL(mismatches, (size_t)0);
+
+    // Camera-less path, panned by the legacy offset
+    map.SetOffset(300, -200);
+    Rect viewport = renderer.GetViewportLocalRect(map, nullptr);
+    renderer.CollectVisibleChunks(viewport, visible);
+    ASSERT_TRUE(visible == ScanVisibleChunks(renderer, viewport));
+    ASSERT_FALSE(visible.empty());
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileMapRenderer_CollectVisibleChunks_TestsOnlyNearbyChunks) {
+    // Largest square map whose pixel size still fits the uint16_t map extents
+    TileMap map(512, 512);
+    ASSERT_TRUE(map.Initialize(1280, 720).success);
+    TileMapRenderer renderer;
+    renderer.Initialize(1280, 720, map);
+    ASSERT_EQUAL(renderer.GetChunkCount(), (size_t)1024);
+
+    Camera2D camera(1280, 720);
+    camera.SetPosition(Point(0, 0));
+    std::vector<size_t> visible;
+    size_t tested = renderer.CollectVisibleChunks(renderer.GetViewportLocalRect(map, &camera), visible);
+
+    ASSERT_FALSE(visible.empty());
+    ASSERT_TRUE(tested >= visible.size());
+    ASSERT_TRUE(tested < 32);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileMapRenderer_SelectLodLevel_HalvesPerLevel) {
+    ASSERT_EQUAL(TileMapRenderer::SelectLodLevel(1.0f), 0);
+    ASSERT_EQUAL(TileMapRenderer::SelectLodLevel(0.5f), 0);
+    ASSERT_EQUAL(TileMapRenderer::SelectLodLevel(0.49f), 1);
+    ASSERT_EQUAL(TileMapRenderer::SelectLodLevel(0.25f), 1);
+    ASSERT_EQUAL(TileMapRenderer::SelectLodLevel(0.2f), 2);
+    ASSERT_EQUAL(TileMapRenderer::SelectLodLevel(Constants::Camera::MIN_ZOOM), TileMapRenderer::MAX_LOD_LEVEL);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileMapRenderer_LodLevels_CoverMapWithFewerChunks) {
+    TileMap map(200, 150);
+    ASSERT_TRUE(map.Initialize(800, 600).success);
+    TileMapRenderer renderer;
+    renderer.Initialize(800, 600, map);
+
+    // 13x10 base chunks -> 7x5 -> 4x3
+    ASSERT_EQUAL(renderer.GetChunkCount(0), (size_t)130);
+    ASSERT_EQUAL(renderer.GetChunkCount(1), (size_t)35);
+    ASSERT_EQUAL(renderer.GetChunkCount(2), (size_t)12);
+
+    // Every level spans the same map-local bounds
+    auto bounds = [&](int level) {
+        int minX = INT32_MAX, minY = INT32_MAX, maxX = INT32_MIN, maxY = INT32_MIN;
+        for (size_t i = 0; i < renderer.GetChunkCount(level); ++i) {
+            Rect r = renderer.GetChunkLocalRect(i, level);
+            minX = std::min(minX, r.x);
+            minY = std::min(minY, r.y);
+            maxX = std::max(maxX, r.x + r.w);
+            maxY = std::max(maxY, r.y + r.h);
+        }
+        return Rect(minX, minY, maxX - minX, maxY - minY);
+    };
+    Rect base = bounds(0);
+    for (int level = 1; level <= TileMapRenderer::MAX_LOD_LEVEL; ++level) {
+        Rect r = bounds(level);
+        ASSERT_TRUE(r.x == base.x && r.y == base.y && r.w == base.w && r.h == base.h);
+    }
+
+    // Whole-city overview: the coarsest level draws a handful of chunks
+    Camera2D camera(800, 600);
+    camera.SetZoom(Constants::Camera::MIN_ZOOM);
+    camera.SetPosition(Point(0, 0));
+    Rect viewport = renderer.GetViewportLocalRect(map, &camera);
+    std::vector<size_t> visible;
+    size_t mismatches = 0;
+    for (int level = 0; level <= TileMapRenderer::MAX_LOD_LEVEL; ++level) {
+        renderer.CollectVisibleChunks(viewport, visible, level);
+        if (visible != ScanVisibleChunks(renderer, viewport, level)) ++mismatches;
+    }
+    ASSERT_EQUAL(mismatches, (size_t)0);
+    renderer.CollectVisibleChunks(viewport, visible, 0);
+    size_t baseDraws = visible.size();
+    renderer.CollectVisibleChunks(viewport, visible, TileMapRenderer::MAX_LOD_LEVEL);
+    ASSERT_TRUE(visible.size() > 0 && visible.size() <= 12);
+    ASSERT_TRUE(visible.size() * 4 < baseDraws);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileMapRenderer_GetPrefetchRect_StretchesAlongVelocity) {
+    Rect view(1000, 500, 800, 400);
+
+    // At rest: a quarter viewport of margin on every side
+    Rect still = TileMapRenderer::GetPrefetchRect(view, 0.0f, 0.0f, 20);
+    ASSERT_EQUAL(still.x, 800);
+    ASSERT_EQUAL(still.y, 400);
+    ASSERT_EQUAL(still.w, 1200);
+    ASSERT_EQUAL(still.h, 600);
+
+    // Panning right and up: the ring reaches 20 frames ahead on those sides only
+    Rect moving = TileMapRenderer::GetPrefetchRect(view, 15.0f, -5.0f, 20);
+    ASSERT_EQUAL(moving.x, 800);
+    ASSERT_EQUAL(moving.x + moving.w, 1000 + 800 + 300 + 200);
+    ASSERT_EQUAL(moving.y, 500 - 100 - 100);
+    ASSERT_EQUAL(moving.y + moving.h, 500 + 400 + 100);
+    return TestResult{__FUNCTION__, true, ""};
+}
+
+namespace {
+    class NullRenderer : public IRenderer {
+    public:
+        Result<void> Initialize(IWindow*, const RendererConfig&) override { return Result<void>::Success(); }
+        void Shutdown() override {}
+        void Clear(const Color&) override {}
+        void Present() override {}
+        SDL_Renderer* GetNativeRenderer() const override { return nullptr; }
+        bool SetVSync(bool) override { return true; }
+        bool IsVSyncEnabled() const override { return false; }
+        bool IsInitialized() const override { return true; }
+        void SetDrawColor(uint8_t, uint8_t, uint8_t, uint8_t) override {}
+        void DrawLines(const Point*, int) override {}
+        void DrawCircle(const Point&, int, int) override {}
+    };
+}
+
+TEST_CASE(TileMapRenderer_Render_TracksViewportVelocity) {
+    TileMap map(128, 128);
+    ASSERT_TRUE(map.Initialize(800, 600).success);
+    TileMapRenderer tiles;
+    tiles.Initialize(800, 600, map);
+    NullRenderer renderer;
+
+    Camera2D camera(800, 600);
+    for (int frame = 0; frame < 30; ++frame) {
+        camera.SetPosition(Point(frame * 12, -frame * 4));
+        tiles.Render(&renderer, map, &camera);
+    }
+    ASSERT_FLOAT_NEAR(tiles.GetViewportVelocityX(), 12.0f, 0.1f);
+    ASSERT_FLOAT_NEAR(tiles.GetViewportVelocityY(), -4.0f, 0.1f);
+
+    // Standing still decays it
+    for (int frame = 0; frame < 30; ++frame) {
+        tiles.Render(&renderer, map, &camera);
+    }
+    ASSERT_FLOAT_NEAR(tiles.GetViewportVelocityX(), 0.0f, 0.1f);
+    ASSERT_EQUAL(tiles.GetChunkTextureBytes(), (size_t)0);
+    return TestResult{__FUNCTION__, true, ""};
+}
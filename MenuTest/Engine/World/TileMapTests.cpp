@@ -248,6 +248,92 @@ TEST_CASE(TileMap_GetTile_IndependentTileModification) {
     return SimpleTest::TestResult{__FUNCTION__, true, ""};
 }
 
+// ============================================================================
+// Tile Change Notification Tests
+// ============================================================================
+
+TEST_CASE(TileMap_SetTileWalkable_NotifiesOnlyOnChange) {
+    TileMap tileMap(10, 10);
+    std::vector<TilePosition> changed;
+    size_t id = tileMap.SubscribeTileChanges([&](const TilePosition& pos) { changed.push_back(pos); });
+    ASSERT_EQUAL(tileMap.GetTileChangeSubscriberCount(), (size_t)1);
+
+    ASSERT_TRUE(tileMap.SetTileWalkable(3, 4, false));
+    ASSERT_TRUE(tileMap.SetTileWalkable(3, 4, false));   // Unchanged: no notification
+    ASSERT_TRUE(tileMap.SetTileId(3, 4, 2));
+    ASSERT_TRUE(tileMap.SetTileId(3, 4, 2));
+    ASSERT_FALSE(tileMap.SetTileWalkable(10, 0, false));
+    ASSERT_FALSE(tileMap.GetTile(3, 4)->IsWalkable());
+    ASSERT_EQUAL(changed.size(), (size_t)2);
+    ASSERT_TRUE(changed[0] == TilePosition(3, 4));
+
+    tileMap.GetTile(5, 5)->SetId(7);
+    tileMap.NotifyTileChanged(5, 5);
+    tileMap.NotifyTileChanged(50, 5);                    // Out of range: ignored
+    ASSERT_EQUAL(changed.size(), (size_t)3);
+
+    tileMap.UnsubscribeTileChanges(id);
+    ASSERT_TRUE(tileMap.SetTileWalkable(3, 4, true));
+    ASSERT_EQUAL(changed.size(), (size_t)3);
+    ASSERT_EQUAL(tileMap.GetTileChangeSubscriberCount(), (size_t)0);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileMap_FlatStorage_ViewMatchesGetTile) {
+    TileMap map(70, 3);  // Row wider than one 64-bit plane word
+    map.GetTile(1, 65)->SetId(9);
+    map.GetTile(2, 0)->SetWalkable(false);
+
+    TileMap::TileView view = map.GetTileView();
+    ASSERT_EQUAL(view.width, (uint16_t)70);
+    ASSERT_EQUAL(view.Size(), (size_t)210);
+    ASSERT_TRUE(&view.At(1, 65) == map.GetTile(1, 65));
+    ASSERT_TRUE(view.Row(2) == map.GetTile(1, 69) + 1);  // Rows are contiguous
+    ASSERT_EQUAL(view.At(1, 65).GetId(), (uint16_t)9);
+    ASSERT_NULL(map.GetTile(3, 0));
+    ASSERT_NULL(map.GetTile(0, 70));
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(TileMap_WalkabilityPlane_TracksEdits) {
+    TileMap map(70, 3);
+    map.GetTile(0, 3)->SetWalkable(false);
+    ASSERT_FALSE(map.HasWalkabilityPlane());
+    ASSERT_NULL(map.GetWalkabilityView().words);
+
+    map.SetWalkabilityPlaneEnabled(true);
+    TileMap::WalkabilityView bits = map.GetWalkabilityView();
+    ASSERT_NOT_NULL(bits.words);
+    ASSERT_EQUAL(bits.wordsPerRow, (size_t)2);
+    ASSERT_FALSE(bits.IsWalkable(0, 3));
+    ASSERT_TRUE(bits.IsWalkable(0, 4));
+    ASSERT_EQUAL(map.CountWalkableTiles(), (size_t)209);
+
+    // Notified edits update the bit before listeners run
+    bool seenBlocked = false;
+    map.SubscribeTileChanges([&](const TilePosition& pos) {
+        seenBlocked = !map.GetWalkabilityView().IsWalkable(pos.row, pos.col);
+    });
+    ASSERT_TRUE(map.SetTileWalkable(2, 66, false));
+    ASSERT_TRUE(seenBlocked);
+    ASSERT_FALSE(bits.IsWalkable(2, 66));
+
+    map.GetTile(0, 3)->SetWalkable(true);
+    map.NotifyTileChanged(0, 3);
+    ASSERT_TRUE(bits.IsWalkable(0, 3));
+
+    // Unnotified bulk edits need a rebuild
+    map.GetTile(1, 1)->SetWalkable(false);
+    ASSERT_EQUAL(map.CountWalkableTiles(), (size_t)209);
+    map.RebuildWalkabilityPlane();
+    ASSERT_EQUAL(map.CountWalkableTiles(), (size_t)208);
+
+    map.SetWalkabilityPlaneEnabled(false);
+    ASSERT_FALSE(map.HasWalkabilityPlane());
+    ASSERT_EQUAL(map.CountWalkableTiles(), (size_t)208);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
 // ============================================================================
 // Offset/Camera Tests
 // ============================================================================
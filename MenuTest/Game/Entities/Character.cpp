@@ -1,4 +1,5 @@
 #include "Character.h"
+#include "CharacterComponents.h"
 #include "../../Engine/Renderer/IRenderer.h"
 #include "../../Engine/Core/Logger/ILogger.h"
 
@@ -17,7 +18,9 @@ namespace Entities {
         , m_sprite(nullptr)
         , m_movement()
         , m_cachedRenderer(nullptr)
-        , m_tilePosition() {
+        , m_tilePosition()
+        , m_components(nullptr)
+        , m_handle() {
 
         m_data.type = type;
         m_data.name = CharacterDataUtils::CharacterTypeToString(type);
@@ -50,6 +53,94 @@ namespace Entities {
     }
 
     Character::~Character() {
+        UnbindComponents();
+    }
+
+    void Character::BindComponents(CharacterComponents* components) {
+        if (m_components == components) return;
+
+        UnbindComponents();
+        if (!components) return;
+
+        m_components = components;
+        m_handle = components->entities.CreateEntity();
+
+        const Engine::ECS::EntityId id = m_handle.id;
+        components->tiles.Add(id, m_tilePosition);
+        components->transforms.Add(id, Engine::ECS::TransformRef{&m_transform});
+        components->movements.Add(id, m_movement);
+        if (m_sprite) {
+            components->animations.Add(id, Engine::ECS::AnimationState{&m_sprite->GetAnimations(), m_sprite->GetPlayback()});
+        }
+    }
+
+    void Character::UnbindComponents() {
+        if (!m_components) return;
+
+        // Copy hot state back so the character stays consistent when standalone
+        const Engine::ECS::EntityId id = m_handle.id;
+        if (const auto* tile = m_components->tiles.Get(id)) {
+            m_tilePosition = *tile;
+        }
+        if (const auto* movement = m_components->movements.Get(id)) {
+            m_movement = *movement;
+        }
+        if (const auto* animation = m_components->animations.Get(id)) {
+            if (m_sprite) m_sprite->GetPlayback() = animation->playback;
+        }
+
+        m_components->tiles.Remove(id);
+        m_components->transforms.Remove(id);
+        m_components->movements.Remove(id);
+        m_components->animations.Remove(id);
+        m_components->entities.DestroyEntity(m_handle);
+
+        m_components = nullptr;
+        m_handle = Engine::ECS::EntityHandle();
+    }
+
+    Engine::SmoothMovement& Character::MovementState() {
+        if (m_components) {
+            if (auto* movement = m_components->movements.Get(m_handle.id)) return *movement;
+        }
+        return m_movement;
+    }
+
+    const Engine::SmoothMovement& Character::MovementState() const {
+        if (m_components) {
+            if (const auto* movement = m_components->movements.Get(m_handle.id)) return *movement;
+        }
+        return m_movement;
+    }
+
+    Engine::TilePosition& Character::TileState() {
+        if (m_components) {
+            if (auto* tile = m_components->tiles.Get(m_handle.id)) return *tile;
+        }
+        return m_tilePosition;
+    }
+
+    const Engine::TilePosition& Character::TileState() const {
+        if (m_components) {
+            if (const auto* tile = m_components->tiles.Get(m_handle.id)) return *tile;
+        }
+        return m_tilePosition;
+    }
+
+    Engine::AnimationPlayback* Character::PlaybackState() {
+        if (!m_sprite) return nullptr;
+        if (m_components) {
+            if (auto* animation = m_components->animations.Get(m_handle.id)) return &animation->playback;
+        }
+        return &m_sprite->GetPlayback();
+    }
+
+    const Engine::AnimationPlayback* Character::PlaybackState() const {
+        if (!m_sprite) return nullptr;
+        if (m_components) {
+            if (const auto* animation = m_components->animations.Get(m_handle.id)) return &animation->playback;
+        }
+        return &m_sprite->GetPlayback();
     }
 
     void Character::InitializeAnimations(const Engine::CharacterSpriteConfig& config) {
@@ -78,25 +169,31 @@ namespace Entities {
                               std::to_string(animConfig.endFrame) + ")");
             }
         }
+
+        // Intern (action, direction) → index once; movement switches by ID afterwards
+        m_animationTable.Build(m_sprite->GetAnimations());
     }
 
     void Character::Update(float deltaTime) {
+        // Per-object path; bound characters are normally advanced in bulk by
+        // CharacterComponents::Update instead of through this virtual call.
         // SmoothMovement interpolates and writes to Transform (single source of truth)
-        if (m_movement.isMoving) {
+        Engine::SmoothMovement& movement = MovementState();
+        if (movement.isMoving) {
             int x, y;
-            m_movement.Update(deltaTime, x, y);
+            movement.Update(deltaTime, x, y);
             m_transform.SetPosition(x, y);
         }
 
         // Update sprite animation
-        if (m_sprite) {
-            m_sprite->Update(deltaTime);
+        if (Engine::AnimationPlayback* playback = PlaybackState()) {
+            Engine::AdvanceAnimation(m_sprite->GetAnimations(), *playback, deltaTime);
         }
     }
 
     void Character::Render() {
         if (m_cachedRenderer && m_sprite) {
-            m_sprite->Render(m_cachedRenderer, m_transform.position.x, m_transform.position.y);
+            m_sprite->Render(m_cachedRenderer, m_transform.position.x, m_transform.position.y, *PlaybackState());
         }
     }
 
@@ -104,7 +201,7 @@ namespace Entities {
         m_cachedRenderer = renderer;  // Cache for parameterless Render()
         
         if (renderer && m_sprite) {
-            m_sprite->Render(renderer, m_transform.position.x, m_transform.position.y);
+            m_sprite->Render(renderer, m_transform.position.x, m_transform.position.y, *PlaybackState());
         }
     }
 
@@ -113,14 +210,42 @@ namespace Entities {
             return false;
         }
 
-        m_sprite->SetAnimation(name);
+        if (!m_components) {
+            m_sprite->SetAnimation(name);
+            return true;
+        }
+
+        int index = m_sprite->FindAnimation(name);
+        if (index >= 0) {
+            PlaybackState()->Play(index);
+        } else if (m_logger) {
+            m_logger->Warning("Character (" + m_data.name + "): Animation '" + name + "' not found");
+        }
+        return true;
+    }
+
+    bool Character::SetAnimation(Engine::AnimationAction action, Direction dir) {
+        return SetAnimationById(m_animationTable.Get(action, dir));
+    }
+
+    bool Character::SetAnimationById(Engine::AnimationId id) {
+        Engine::AnimationPlayback* playback = PlaybackState();
+        if (!playback || id < 0 || id >= static_cast<int>(m_sprite->GetAnimations().size())) {
+            return false;
+        }
+
+        playback->Play(id);
         return true;
     }
 
     const std::string& Character::GetCurrentAnimation() const {
         static const std::string empty = "";
-        if (m_sprite) {
-            return m_sprite->GetCurrentAnimationName();
+        const Engine::AnimationPlayback* playback = PlaybackState();
+        if (playback) {
+            const auto& animations = m_sprite->GetAnimations();
+            if (playback->animation >= 0 && playback->animation < static_cast<int>(animations.size())) {
+                return animations[playback->animation].name;
+            }
         }
         return empty;
     }
@@ -134,12 +259,12 @@ namespace Entities {
 
     void Character::UpdateDirectionAnimation() {
         // Update animation based on direction
-        std::string animName = CharacterDataUtils::GetWalkAnimationForDirection(m_direction);
-        SetAnimation(animName);
+        SetAnimation(Engine::AnimationAction::Walk, m_direction);
     }
 
     void Character::MoveTo(int x, int y, float duration) {
-        m_movement.Start(m_transform.position.x, m_transform.position.y, x, y, duration);
+        MovementState().Start(m_transform.position.x, m_transform.position.y, x, y, duration);
+        if (m_components) m_components->movements.MarkChanged(m_handle.id);
     }
 
     void Character::MoveTo(const Engine::Point& pos, float duration) {
@@ -147,21 +272,23 @@ namespace Entities {
     }
 
     bool Character::IsMoving() const {
-        return m_movement.isMoving;
+        return MovementState().isMoving;
     }
 
     void Character::StopMovement() {
         int x, y;
-        m_movement.Stop(x, y);
+        MovementState().Stop(x, y);
+        if (m_components) m_components->movements.MarkChanged(m_handle.id);
         m_transform.SetPosition(x, y);
     }
 
     void Character::SetTilePosition(const Engine::TilePosition& pos) {
-        m_tilePosition = pos;
+        TileState() = pos;
+        if (m_components) m_components->tiles.MarkChanged(m_handle.id);
     }
 
     void Character::SetTilePosition(uint16_t row, uint16_t col) {
-        m_tilePosition = Engine::TilePosition(row, col);
+        SetTilePosition(Engine::TilePosition(row, col));
     }
 
 } // namespace Entities
@@ -2,6 +2,7 @@
 
 #include "../../Engine/Entity/Entity.h"
 #include "../../Engine/Graphics/AnimatedSprite.h"
+#include "../../Engine/ECS/EntityManager.h"
 #include "CharacterData.h"
 #include <memory>
 
@@ -12,10 +13,16 @@ namespace Engine {
 namespace LegalCrime {
 namespace Entities {
 
+    struct CharacterComponents;
+
     /// <summary>
     /// Game character entity with sprite rendering and movement.
     /// Transform is the single source of truth for position.
     /// SmoothMovement handles interpolation and writes to Transform.
+    ///
+    /// When bound to CharacterComponents (World does this on AddEntity), tile position,
+    /// movement and animation playback live in ECS storages and are advanced in bulk;
+    /// this class becomes a thin facade whose accessors forward to those components.
     /// </summary>
     class Character : public Engine::Entity {
     public:
@@ -38,6 +45,14 @@ namespace Entities {
         bool SetAnimation(const std::string& name);
         const std::string& GetCurrentAnimation() const;
 
+        // Interned animation control — hot path (no allocation, no hashing).
+        // IDs are resolved once in InitializeAnimations.
+        bool SetAnimation(Engine::AnimationAction action, Direction dir);
+        bool SetAnimationById(Engine::AnimationId id);
+        Engine::AnimationId GetAnimationId(Engine::AnimationAction action, Direction dir) const {
+            return m_animationTable.Get(action, dir);
+        }
+
         // Direction control
         void SetDirection(Direction dir);
         Direction GetDirection() const { return m_direction; }
@@ -51,9 +66,16 @@ namespace Entities {
         // Tile position (for grid-based movement)
         void SetTilePosition(const Engine::TilePosition& pos);
         void SetTilePosition(uint16_t row, uint16_t col);
-        Engine::TilePosition GetTilePosition() const { return m_tilePosition; }
-        uint16_t GetTileRow() const { return m_tilePosition.row; }
-        uint16_t GetTileCol() const { return m_tilePosition.col; }
+        Engine::TilePosition GetTilePosition() const { return TileState(); }
+        uint16_t GetTileRow() const { return TileState().row; }
+        uint16_t GetTileCol() const { return TileState().col; }
+
+        // ECS binding — moves hot state into the given storages (nullptr unbinds).
+        // Unbinding copies the component state back into the character.
+        void BindComponents(CharacterComponents* components);
+        void UnbindComponents();
+        bool IsBound() const { return m_components != nullptr; }
+        Engine::ECS::EntityHandle GetComponentHandle() const { return m_handle; }
 
         // Character data
         CharacterType GetCharacterType() const { return m_characterType; }
@@ -68,12 +90,25 @@ namespace Entities {
         CharacterData m_data;
         Direction m_direction;
         std::unique_ptr<Engine::AnimatedSprite> m_sprite;
+        Engine::DirectionalAnimationTable m_animationTable;
         Engine::SmoothMovement m_movement;
         Engine::IRenderer* m_cachedRenderer;  // For parameterless Render()
 
         // Tile position
         Engine::TilePosition m_tilePosition;
 
+        // ECS binding (null when standalone)
+        CharacterComponents* m_components;
+        Engine::ECS::EntityHandle m_handle;
+
+        // Hot-state accessors: the bound component, or the local fallback when unbound
+        Engine::SmoothMovement& MovementState();
+        const Engine::SmoothMovement& MovementState() const;
+        Engine::TilePosition& TileState();
+        const Engine::TilePosition& TileState() const;
+        Engine::AnimationPlayback* PlaybackState();
+        const Engine::AnimationPlayback* PlaybackState() const;
+
         void InitializeAnimations(const Engine::CharacterSpriteConfig& config);
         void UpdateDirectionAnimation();
     };
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "../../Engine/ECS/EntityManager.h"
+#include "../../Engine/ECS/ComponentStorage.h"
+#include "../../Engine/ECS/Components.h"
+#include "../../Engine/ECS/MovementInterpolationSystem.h"
+#include "../../Engine/ECS/AnimationSystem.h"
+
+namespace LegalCrime {
+namespace Entities {
+
+    /// <summary>
+    /// ECS storage for Character hot state: tile position, transform reference,
+    /// movement interpolation and animation playback.
+    /// Owned by World. Characters added to a World are bound to it and their
+    /// accessors forward to these components (see Character::BindComponents).
+    /// </summary>
+    struct CharacterComponents {
+        Engine::ECS::EntityManager entities;
+        Engine::ECS::ComponentStorage<Engine::TilePosition> tiles;
+        Engine::ECS::ComponentStorage<Engine::ECS::TransformRef> transforms;
+        Engine::ECS::ComponentStorage<Engine::SmoothMovement> movements;
+        Engine::ECS::ComponentStorage<Engine::ECS::AnimationState> animations;
+
+        Engine::ECS::MovementInterpolationSystem movementSystem{movements, transforms};
+        Engine::ECS::AnimationSystem animationSystem{animations};
+
+        CharacterComponents() = default;
+        CharacterComponents(const CharacterComponents&) = delete;
+        CharacterComponents& operator=(const CharacterComponents&) = delete;
+
+        /// Advance every bound character's movement and animation in bulk.
+        /// Ends the change-detection frame on each storage afterwards.
+        void Update(float deltaTime) {
+            movementSystem.Update(deltaTime, entities);
+            animationSystem.Update(deltaTime, entities);
+
+            tiles.EndFrame();
+            transforms.EndFrame();
+            movements.EndFrame();
+            animations.EndFrame();
+        }
+    };
+
+} // namespace Entities
+} // namespace LegalCrime
@@ -31,6 +31,12 @@ namespace LegalCrime {
         Engine::TilePosition target;
     };
 
+    // A character came into the player's view because its tile became visible.
+    struct UnitSpottedEvent {
+        uint32_t entityId;
+        Engine::TilePosition position;
+    };
+
     // Global domain event bus for game-layer events.
     inline Engine::EventBus& DomainEventBus() {
         static Engine::EventBus bus;
@@ -14,6 +14,14 @@ namespace Constants {
         constexpr float DEFAULT_SEPARATION_STRENGTH = 100.0f;
         constexpr float MIN_DISTANCE = 0.1f;
         constexpr float PUSH_THRESHOLD = 0.01f;
+
+        // ORCA mode
+        constexpr float DEFAULT_AGENT_RADIUS = 16.0f;        // Pixels
+        constexpr float DEFAULT_NEIGHBOR_DISTANCE = 96.0f;   // Pixels; also the grid cell size
+        constexpr float DEFAULT_TIME_HORIZON = 0.5f;         // Seconds of look-ahead
+        constexpr float MIN_AVOIDANCE_SPEED = 60.0f;         // Pixels/s an idle unit may sidestep at
+        constexpr float OFFSET_RETURN_RATE = 4.0f;           // 1/s pull back onto the movement path
+        constexpr int MAX_ORCA_NEIGHBORS = 10;
     }
 
     // Main menu UI layout
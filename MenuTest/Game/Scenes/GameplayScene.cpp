@@ -6,6 +6,7 @@
 #include "../../Engine/World/TileMapRenderer.h"
 #include "../../Engine/Camera/Camera2D.h"
 #include "../World/Systems/SelectionSystem.h"
+#include "../Entities/Character.h"
 #include "../../Engine/Core/Constants.h"
 
 namespace LegalCrime {
@@ -93,11 +94,30 @@ namespace LegalCrime {
             gapTile->SetId(1);
         }
 
+        // Path searches read walkability from the bit plane; built after
+        // the direct edits above, kept in step by notified edits from here on
+        m_tileMap->SetWalkabilityPlaneEnabled(true);
+
+        // Later tile edits (doors, destruction) re-bake only their own chunk
+        m_tileRenderSubscription = m_tileMap->SubscribeTileChanges([this](const Engine::TilePosition& pos) {
+            m_tileMapRenderer->InvalidateTile(pos.row, pos.col);
+        });
+
         auto simInit = m_simulation->Initialize(m_tileMap.get());
         if (!simInit) {
             return Engine::Result<void>::Failure("Failed to initialize simulation: " + simInit.error);
         }
 
+        // On-screen units get their paths before off-screen ones
+        m_simulation->SetVisibilityTest([this](const Entities::Character* character) {
+            if (!m_camera || !m_tileMap) {
+                return false;
+            }
+            Engine::Point screen = m_tileMap->TileToScreenCenter(character->GetTilePosition(), m_camera.get());
+            return screen.x >= 0 && screen.y >= 0 &&
+                   screen.x < m_camera->GetViewportWidth() && screen.y < m_camera->GetViewportHeight();
+        });
+
         m_initialized = true;
 
         if (m_logger) {
@@ -119,6 +139,9 @@ namespace LegalCrime {
         if (m_simulation) {
             m_simulation->Shutdown();
         }
+        if (m_tileMap) {
+            m_tileMap->UnsubscribeTileChanges(m_tileRenderSubscription);
+        }
         m_tileMapRenderer.reset();
         m_tileMap.reset();
         m_camera.reset();
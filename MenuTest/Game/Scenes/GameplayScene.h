@@ -68,5 +68,6 @@ namespace LegalCrime {
         std::unique_ptr<GameplayInputHandler> m_inputHandler;
         std::unique_ptr<GameplayRenderer> m_gameplayRenderer;
         Engine::Input::InputManager* m_inputManager;
+        size_t m_tileRenderSubscription = 0;  // Re-bakes the chunk of an edited tile
     };
 }
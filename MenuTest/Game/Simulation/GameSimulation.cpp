@@ -45,9 +45,24 @@ namespace Simulation {
         m_movementSystem = std::make_unique<World::MovementSystem>(m_logger);
         m_movementSystem->Initialize(tileMap);
 
+        m_tileMap = tileMap;
+        m_tileSubscription = tileMap->SubscribeTileChanges([this](const Engine::TilePosition& pos) {
+            m_movementSystem->OnTileChanged(pos);
+        });
+
         m_selectionSystem = std::make_unique<World::SelectionSystem>(m_logger);
         m_commandSystem = std::make_unique<World::CommandSystem>(m_logger);
 
+        m_movementSystem->SetPathPriorityFn([this](Entities::Character* character) {
+            if (m_selectionSystem && m_selectionSystem->IsSelected(character)) {
+                return World::PathPriority::Selected;
+            }
+            if (m_visibilityTest && m_visibilityTest(character)) {
+                return World::PathPriority::Visible;
+            }
+            return World::PathPriority::Background;
+        });
+
         // Spawn a starter character to keep the existing gameplay behavior.
         if (m_characterFactory) {
             auto characterUnique = m_characterFactory->CreateCharacter(Entities::CharacterType::Thug);
@@ -73,6 +88,11 @@ namespace Simulation {
             return;
         }
 
+        if (m_tileMap) {
+            m_tileMap->UnsubscribeTileChanges(m_tileSubscription);
+            m_tileMap = nullptr;
+        }
+
         m_primaryCharacter = nullptr;
         m_commandSystem.reset();
         m_selectionSystem.reset();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Engine/Core/Types.h"
+#include <functional>
 #include <memory>
 
 namespace Engine {
@@ -44,6 +45,11 @@ namespace Simulation {
 
         bool MoveCharacterToTile(const Engine::TilePosition& target, float duration = 0.3f);
 
+        // Lets the presentation layer report on-screen units; their path
+        // requests are searched before off-screen ones (after selected units).
+        using VisibilityTest = std::function<bool(const Entities::Character*)>;
+        void SetVisibilityTest(VisibilityTest test) { m_visibilityTest = std::move(test); }
+
     private:
         Engine::ILogger* m_logger;
         Engine::Resources::ResourceManager* m_resourceManager;
@@ -54,6 +60,11 @@ namespace Simulation {
         std::unique_ptr<World::MovementSystem> m_movementSystem;
         std::unique_ptr<World::SelectionSystem> m_selectionSystem;
         std::unique_ptr<World::CommandSystem> m_commandSystem;
+        VisibilityTest m_visibilityTest;
+
+        // Tile edits invalidate paths that cross them
+        Engine::TileMap* m_tileMap = nullptr;
+        size_t m_tileSubscription = 0;
 
         // Convenience pointer to spawned starter unit, owned by World.
         Entities::Character* m_primaryCharacter;
@@ -0,0 +1,106 @@
+#include "FactionVisibility.h"
+#include "../../../Engine/Core/BitOps.h"
+#include <algorithm>
+
+namespace LegalCrime {
+namespace World {
+
+    FactionVisibility::FactionVisibility(uint16_t mapWidth, uint16_t mapHeight, uint8_t factionCount)
+        : m_width(mapWidth)
+        , m_height(mapHeight)
+        , m_factionCount(std::min(factionCount, MAX_FACTIONS))
+        , m_wordCount((static_cast<size_t>(mapWidth) * mapHeight + 63) / 64)
+        , m_planes(static_cast<size_t>(m_factionCount) * 2 * m_wordCount, 0) {
+    }
+
+    void FactionVisibility::BeginFrame() {
+        for (uint8_t faction = 0; faction < m_factionCount; ++faction) {
+            BeginFrame(faction);
+        }
+    }
+
+    void FactionVisibility::BeginFrame(uint8_t faction) {
+        if (faction >= m_factionCount) return;
+        Engine::BitOps::ClearWords(Plane(faction, VISIBLE), m_wordCount);
+    }
+
+    void FactionVisibility::RevealAround(uint8_t faction, VisionSystem& vision,
+                                         const Engine::TilePosition& center, uint16_t visionRadius) {
+        vision.ComputeView(center, visionRadius, m_viewScratch);
+        Reveal(faction, m_viewScratch);
+    }
+
+    void FactionVisibility::Reveal(uint8_t faction, const std::vector<uint32_t>& tiles) {
+        if (faction >= m_factionCount) return;
+        uint64_t* visible = Plane(faction, VISIBLE);
+        uint64_t* explored = Plane(faction, EXPLORED);
+        size_t tileCount = static_cast<size_t>(m_width) * m_height;
+        for (uint32_t index : tiles) {
+            if (index >= tileCount) continue;
+            uint64_t bit = uint64_t(1) << (index & 63);
+            visible[index >> 6] |= bit;
+            explored[index >> 6] |= bit;
+        }
+    }
+
+    void FactionVisibility::SetVisible(uint8_t faction, uint16_t row, uint16_t col) {
+        if (faction >= m_factionCount || row >= m_height || col >= m_width) return;
+        size_t index = static_cast<size_t>(row) * m_width + col;
+        uint64_t bit = uint64_t(1) << (index & 63);
+        Plane(faction, VISIBLE)[index >> 6] |= bit;
+        Plane(faction, EXPLORED)[index >> 6] |= bit;
+    }
+
+    bool FactionVisibility::CanSee(uint8_t faction, uint16_t row, uint16_t col) const {
+        return TestBit(faction, VISIBLE, row, col);
+    }
+
+    bool FactionVisibility::HasExplored(uint8_t faction, uint16_t row, uint16_t col) const {
+        return TestBit(faction, EXPLORED, row, col);
+    }
+
+    TileVisibility FactionVisibility::GetVisibility(uint8_t faction, uint16_t row, uint16_t col) const {
+        if (CanSee(faction, row, col)) return TileVisibility::Visible;
+        if (HasExplored(faction, row, col)) return TileVisibility::Explored;
+        return TileVisibility::Unexplored;
+    }
+
+    uint8_t FactionVisibility::GetSeenByMask(uint16_t row, uint16_t col) const {
+        if (row >= m_height || col >= m_width) return 0;
+        size_t index = static_cast<size_t>(row) * m_width + col;
+        uint8_t mask = 0;
+        for (uint8_t faction = 0; faction < m_factionCount; ++faction) {
+            uint64_t word = Plane(faction, VISIBLE)[index >> 6];
+            mask |= static_cast<uint8_t>(((word >> (index & 63)) & 1u) << faction);
+        }
+        return mask;
+    }
+
+    void FactionVisibility::ShareVision(uint8_t from, uint8_t to) {
+        if (from >= m_factionCount || to >= m_factionCount || from == to) return;
+        Engine::BitOps::OrWords(Plane(to, VISIBLE), Plane(from, VISIBLE), m_wordCount);
+        Engine::BitOps::OrWords(Plane(to, EXPLORED), Plane(from, EXPLORED), m_wordCount);
+    }
+
+    size_t FactionVisibility::CountVisible(uint8_t faction) const {
+        if (faction >= m_factionCount) return 0;
+        return Engine::BitOps::CountSetBits(Plane(faction, VISIBLE), m_wordCount);
+    }
+
+    size_t FactionVisibility::CountExplored(uint8_t faction) const {
+        if (faction >= m_factionCount) return 0;
+        return Engine::BitOps::CountSetBits(Plane(faction, EXPLORED), m_wordCount);
+    }
+
+    void FactionVisibility::Reset() {
+        Engine::BitOps::ClearWords(m_planes.data(), m_planes.size());
+    }
+
+    bool FactionVisibility::TestBit(uint8_t faction, size_t plane, uint16_t row, uint16_t col) const {
+        if (faction >= m_factionCount || row >= m_height || col >= m_width) return false;
+        size_t index = static_cast<size_t>(row) * m_width + col;
+        return (Plane(faction, plane)[index >> 6] >> (index & 63)) & 1u;
+    }
+
+} // namespace World
+} // namespace LegalCrime
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../../../Engine/Core/Types.h"
+#include "VisionSystem.h"
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace LegalCrime {
+namespace World {
+
+    /// Per-faction fog of war as bit planes: for every faction one Visible
+    /// and one Explored bit per tile, packed 64 tiles to a word. Explored
+    /// includes Visible, so "can faction X see / has it seen tile Y" is a
+    /// single bit test. Frame reset, vision sharing and counting run a whole
+    /// plane at a time through the SIMD word helpers in BitOps.
+    ///
+    /// Line of sight comes from a VisionSystem (RevealAround) or any tile
+    /// list in VisionSystem::ComputeView's row * width + col form.
+    class FactionVisibility {
+    public:
+        static constexpr uint8_t MAX_FACTIONS = 8;
+
+        FactionVisibility(uint16_t mapWidth, uint16_t mapHeight, uint8_t factionCount);
+
+        /// Clear every faction's Visible plane; Explored is kept.
+        void BeginFrame();
+        void BeginFrame(uint8_t faction);
+
+        /// Reveal a unit's view for a faction, casting through vision.
+        void RevealAround(uint8_t faction, VisionSystem& vision,
+                          const Engine::TilePosition& center, uint16_t visionRadius);
+
+        /// Reveal precomputed tile indices (row * width + col).
+        void Reveal(uint8_t faction, const std::vector<uint32_t>& tiles);
+        void SetVisible(uint8_t faction, uint16_t row, uint16_t col);
+
+        /// O(1) queries. Out-of-range tiles and factions read as unseen.
+        bool CanSee(uint8_t faction, uint16_t row, uint16_t col) const;
+        bool HasExplored(uint8_t faction, uint16_t row, uint16_t col) const;
+        TileVisibility GetVisibility(uint8_t faction, uint16_t row, uint16_t col) const;
+
+        /// Bit f set when faction f currently sees the tile.
+        uint8_t GetSeenByMask(uint16_t row, uint16_t col) const;
+
+        /// Give faction to everything faction from sees and has explored (allies, spotters).
+        void ShareVision(uint8_t from, uint8_t to);
+
+        size_t CountVisible(uint8_t faction) const;
+        size_t CountExplored(uint8_t faction) const;
+
+        /// Raw planes for bulk consumers (BitOps::ForEachSetBit).
+        const uint64_t* GetVisiblePlane(uint8_t faction) const { return Plane(faction, VISIBLE); }
+        const uint64_t* GetExploredPlane(uint8_t faction) const { return Plane(faction, EXPLORED); }
+        size_t GetWordCount() const { return m_wordCount; }
+
+        /// Everything back to Unexplored for every faction.
+        void Reset();
+
+        uint8_t GetFactionCount() const { return m_factionCount; }
+        uint16_t GetWidth() const { return m_width; }
+        uint16_t GetHeight() const { return m_height; }
+
+    private:
+        static constexpr size_t VISIBLE = 0;
+        static constexpr size_t EXPLORED = 1;
+
+        uint64_t* Plane(uint8_t faction, size_t plane) {
+            return m_planes.data() + (static_cast<size_t>(faction) * 2 + plane) * m_wordCount;
+        }
+        const uint64_t* Plane(uint8_t faction, size_t plane) const {
+            return m_planes.data() + (static_cast<size_t>(faction) * 2 + plane) * m_wordCount;
+        }
+        bool TestBit(uint8_t faction, size_t plane, uint16_t row, uint16_t col) const;
+
+        uint16_t m_width;
+        uint16_t m_height;
+        uint8_t m_factionCount;
+        size_t m_wordCount;             // Words per plane
+        std::vector<uint64_t> m_planes; // [faction][Visible, Explored][word]
+        std::vector<uint32_t> m_viewScratch;
+    };
+
+} // namespace World
+} // namespace LegalCrime
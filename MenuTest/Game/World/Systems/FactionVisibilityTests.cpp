@@ -0,0 +1,94 @@
+#include "../../../Tests/SimpleTest.h"
+#include "FactionVisibility.h"
+
+using LegalCrime::World::FactionVisibility;
+using LegalCrime::World::TileVisibility;
+
+TEST_CASE(FactionVisibility_FactionsAreIndependent) {
+    FactionVisibility fog(20, 20, 3);
+    ASSERT_FALSE(fog.CanSee(0, 5, 5));
+    ASSERT_TRUE(fog.GetVisibility(1, 5, 5) == TileVisibility::Unexplored);
+
+    fog.SetVisible(1, 5, 5);
+    fog.SetVisible(2, 5, 5);
+    ASSERT_FALSE(fog.CanSee(0, 5, 5));
+    ASSERT_TRUE(fog.CanSee(1, 5, 5));
+    ASSERT_TRUE(fog.HasExplored(1, 5, 5));
+    ASSERT_EQUAL(fog.GetSeenByMask(5, 5), (uint8_t)0x6);
+    ASSERT_EQUAL(fog.GetSeenByMask(5, 6), (uint8_t)0);
+
+    // Out of range reads as unseen and writes are ignored
+    fog.SetVisible(7, 5, 5);
+    ASSERT_FALSE(fog.CanSee(7, 5, 5));
+    ASSERT_FALSE(fog.CanSee(1, 25, 5));
+    return {"FactionVisibility_FactionsAreIndependent", true, ""};
+}
+
+TEST_CASE(FactionVisibility_BeginFrame_KeepsExplored) {
+    FactionVisibility fog(20, 20, 2);
+    fog.SetVisible(0, 3, 4);
+    fog.SetVisible(1, 8, 8);
+    fog.BeginFrame(0);
+    ASSERT_FALSE(fog.CanSee(0, 3, 4));
+    ASSERT_TRUE(fog.GetVisibility(0, 3, 4) == TileVisibility::Explored);
+    ASSERT_TRUE(fog.CanSee(1, 8, 8));
+
+    fog.BeginFrame();
+    ASSERT_FALSE(fog.CanSee(1, 8, 8));
+    ASSERT_TRUE(fog.HasExplored(1, 8, 8));
+
+    fog.Reset();
+    ASSERT_FALSE(fog.HasExplored(1, 8, 8));
+    return {"FactionVisibility_BeginFrame_KeepsExplored", true, ""};
+}
+
+TEST_CASE(FactionVisibility_RevealAround_MatchesVisionSystem) {
+    LegalCrime::World::VisionSystem vision(40, 40);
+    for (uint16_t row = 10; row < 30; ++row) {
+        vision.SetTileOpaque(row, 22, true);
+    }
+    FactionVisibility fog(40, 40, 2);
+    fog.RevealAround(1, vision, Engine::TilePosition(20, 18), 9);
+    vision.RevealAround(Engine::TilePosition(20, 18), 9);
+
+    bool matches = true;
+    for (uint16_t row = 0; row < 40; ++row) {
+        for (uint16_t col = 0; col < 40; ++col) {
+            matches = matches && (fog.CanSee(1, row, col) == vision.IsVisible(row, col));
+        }
+    }
+    ASSERT_TRUE(matches);
+    ASSERT_FALSE(fog.CanSee(1, 20, 25));
+    ASSERT_EQUAL(fog.CountVisible(0), (size_t)0);
+    return {"FactionVisibility_RevealAround_MatchesVisionSystem", true, ""};
+}
+
+TEST_CASE(FactionVisibility_ShareAndCount_OddPlaneSize) {
+    // 37 x 29 = 1073 tiles: 17 words, so the SIMD loops leave a scalar tail
+    FactionVisibility fog(37, 29, 2);
+    ASSERT_EQUAL(fog.GetWordCount(), (size_t)17);
+
+    size_t expected = 0;
+    for (uint16_t row = 0; row < 29; ++row) {
+        for (uint16_t col = 0; col < 37; ++col) {
+            if ((row * 37 + col) % 3 == 0) {
+                fog.SetVisible(0, row, col);
+                ++expected;
+            }
+        }
+    }
+    fog.SetVisible(0, 28, 36);  // Last tile, in the tail word
+    expected += ((28 * 37 + 36) % 3 == 0) ? 0 : 1;
+    fog.SetVisible(1, 0, 1);
+    ASSERT_EQUAL(fog.CountVisible(0), expected);
+
+    fog.ShareVision(0, 1);
+    ASSERT_EQUAL(fog.CountVisible(1), expected + 1);
+    ASSERT_TRUE(fog.CanSee(1, 28, 36));
+    ASSERT_FALSE(fog.CanSee(0, 0, 1));
+
+    fog.BeginFrame();
+    ASSERT_EQUAL(fog.CountVisible(1), (size_t)0);
+    ASSERT_EQUAL(fog.CountExplored(1), expected + 1);
+    return {"FactionVisibility_ShareAndCount_OddPlaneSize", true, ""};
+}
@@ -0,0 +1,116 @@
+#include "../../../Tests/SimpleTest.h"
+#include "MovementSystem.h"
+#include "../World.h"
+#include "../../Entities/Character.h"
+#include "../../../Engine/Graphics/CharacterSpriteConfig.h"
+#include <chrono>
+#include <iostream>
+
+TEST_CASE(MovementBench_5000_SimultaneousMovers) {
+    LegalCrime::World::World world(4000, 4000, 64, nullptr);
+    LegalCrime::World::MovementSystem movement(nullptr);
+    Engine::CharacterSpriteConfig config;
+
+    // 5k units on a 100x100 block, each walking a 40-tile zig-zag path
+    const int unitCount = 5000;
+    const uint16_t pathLength = 40;
+    std::vector<LegalCrime::Entities::Character*> units;
+    units.reserve(unitCount);
+    for (int i = 0; i < unitCount; ++i) {
+        auto ch = std::make_unique<LegalCrime::Entities::Character>(
+            LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+        uint16_t row = static_cast<uint16_t>(i / 50);
+        uint16_t col = static_cast<uint16_t>((i % 50) * 2);
+        units.push_back(world.SpawnCharacter(std::move(ch), Engine::TilePosition(row, col)));
+    }
+
+    for (auto* unit : units) {
+        Engine::TilePosition start = unit->GetTilePosition();
+        Engine::Path path;
+        path.reserve(pathLength);
+        for (uint16_t step = 1; step <= pathLength; ++step) {
+            path.emplace_back(static_cast<uint16_t>(start.row + step),
+                              static_cast<uint16_t>(start.col + (step & 1)));
+        }
+        ASSERT_TRUE(movement.MoveCharacterAlongPath(unit, path, 0.05f));
+    }
+    ASSERT_EQUAL(movement.GetActiveMoverCount(), (size_t)unitCount);
+
+    // 60 ticks at 60 Hz: each unit completes ~20 tile steps
+    const int ticks = 60;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+        movement.Update(&world, 1.0f / 60.0f);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    std::cout << "  [bench] MovementSystem 5k movers: " << (us / ticks) << " us/tick ("
+              << ticks << " ticks, arena " << movement.GetPathArenaSize() << " tiles)" << std::endl;
+
+    ASSERT_EQUAL(movement.GetActiveMoverCount(), (size_t)unitCount);
+    ASSERT_TRUE(units[0]->GetTilePosition().row > 0);
+    ASSERT_TRUE(us < 10000000);
+    return {"MovementBench_5000_SimultaneousMovers", true, ""};
+}
+
+TEST_CASE(MovementBench_ParallelScaling_20k) {
+    // Same 20k-unit scenario at 1, 2, 4 and 8 integration threads.
+    // Finished steps still merge serially (occupancy + events), so the
+    // speedup is bounded by the share of movers that change tile per tick.
+    const int unitCount = 20000;
+    const uint16_t pathLength = 40;
+    const int ticks = 60;
+    const size_t threadCounts[] = {1, 2, 4, 8};
+    long long serialUs = 0;
+    Engine::TilePosition serialEnd;
+
+    for (size_t threads : threadCounts) {
+        LegalCrime::World::World world(20000, 20000, 64, nullptr);
+        LegalCrime::World::MovementSystem movement(nullptr);
+        movement.SetThreadCount(threads);
+        Engine::CharacterSpriteConfig config;
+
+        std::vector<LegalCrime::Entities::Character*> units;
+        units.reserve(unitCount);
+        for (int i = 0; i < unitCount; ++i) {
+            auto ch = std::make_unique<LegalCrime::Entities::Character>(
+                LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+            uint16_t row = static_cast<uint16_t>((i / 100) * 2);
+            uint16_t col = static_cast<uint16_t>((i % 100) * 2);
+            units.push_back(world.SpawnCharacter(std::move(ch), Engine::TilePosition(row, col)));
+        }
+
+        for (size_t i = 0; i < units.size(); ++i) {
+            Engine::TilePosition start = units[i]->GetTilePosition();
+            Engine::Path path;
+            path.reserve(pathLength);
+            for (uint16_t step = 1; step <= pathLength; ++step) {
+                path.emplace_back(static_cast<uint16_t>(start.row + (step & 1)),
+                                  static_cast<uint16_t>(start.col + step));
+            }
+            // Staggered step durations spread tile changes across ticks
+            movement.MoveCharacterAlongPath(units[i], path, 0.2f + 0.05f * static_cast<float>(i % 5));
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int tick = 0; tick < ticks; ++tick) {
+            movement.Update(&world, 1.0f / 60.0f);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        if (threads == 1) {
+            serialUs = us;
+            serialEnd = units.back()->GetTilePosition();
+        }
+        std::cout << "  [bench] MovementSystem 20k movers, " << threads << " thread(s): "
+                  << (us / ticks) << " us/tick (x"
+                  << (us > 0 ? static_cast<double>(serialUs) / static_cast<double>(us) : 0.0)
+                  << " vs serial)" << std::endl;
+
+        ASSERT_TRUE(units.back()->GetTilePosition() == serialEnd);
+        ASSERT_TRUE(us < 20000000);
+    }
+    return {"MovementBench_ParallelScaling_20k", true, ""};
+}
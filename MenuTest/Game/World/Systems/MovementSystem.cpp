@@ -3,6 +3,9 @@
 #include "../../Entities/Character.h"
 #include "../../../Engine/World/TileMap.h"
 #include "../../../Engine/Core/Logger/ILogger.h"
+#include "../../../Engine/Core/ThreadPool.h"
+#include <algorithm>
+#include <cstdlib>
 
 namespace LegalCrime {
 namespace World {
@@ -10,7 +13,8 @@ namespace World {
     MovementSystem::MovementSystem(Engine::ILogger* logger)
         : m_logger(logger)
         , m_tileMap(nullptr)
-        , m_pathfinder(nullptr) {
+        , m_pathfinder(nullptr)
+        , m_stepBuffers(1) {
 
         if (m_logger) {
             m_logger->Debug("MovementSystem created");
@@ -46,22 +50,51 @@ namespace World {
             return;
         }
 
+        m_time += deltaTime;
         ProcessPathfindingBudget();
 
-        // Update all moving characters
-        std::vector<uint32_t> completed;
-        for (auto& [id, state] : m_movingCharacters) {
-            if (state.isMoving && state.character) {
-                UpdateCharacterMovement(state, deltaTime);
-            }
-            if (!state.isMoving) {
-                completed.push_back(id);
+        // Integrate: advance timers and record finished steps. Touches only
+        // per-mover state and the (read-only) path arena, so ranges run in parallel
+        size_t moverCount = m_movers.character.size();
+        if (m_threadPool && moverCount >= MIN_MOVERS_PER_THREAD * m_threadPool->GetThreadCount()) {
+            m_threadPool->ParallelFor(moverCount, [this, deltaTime](size_t begin, size_t end, size_t range) {
+                IntegrateRange(begin, end, deltaTime, m_stepBuffers[range]);
+            });
+        } else {
+            IntegrateRange(0, moverCount, deltaTime, m_stepBuffers[0]);
+        }
+
+        // Merge: apply shared writes on this thread. Buffers hold contiguous
+        // ascending mover ranges, so this is mover order for any thread count
+        for (auto& steps : m_stepBuffers) {
+            for (const StepResult& step : steps) {
+                ApplyStep(world, step);
             }
+            steps.clear();
+        }
+
+        if (m_pathArena.size() > 1024 && m_pathArena.size() > 2 * m_pathArenaLive) {
+            CompactPathArena();
+        }
+    }
+
+    void MovementSystem::SetThreadCount(size_t threadCount) {
+        if (threadCount == 0) {
+            threadCount = 1;
+        }
+        if (threadCount == m_stepBuffers.size()) {
+            return;
+        }
+
+        m_threadPool.reset();
+        if (threadCount > 1) {
+            m_threadPool = std::make_unique<Engine::ThreadPool>(threadCount);
         }
+        m_stepBuffers.clear();
+        m_stepBuffers.resize(threadCount);
 
-        // Remove completed movements
-        for (uint32_t id : completed) {
-            m_movingCharacters.erase(id);
+        if (m_logger) {
+            m_logger->Info("MovementSystem using " + std::to_string(threadCount) + " thread(s)");
         }
     }
 
@@ -77,7 +110,18 @@ namespace World {
             return false;
         }
 
-        m_pendingPathRequests.push_back(PathRequest{character, target, duration});
+        // Newest order wins; the request keeps its place in the age order
+        auto it = m_pendingByEntity.find(character->GetId());
+        if (it != m_pendingByEntity.end()) {
+            PathRequest& pending = m_pendingPathRequests[it->second];
+            pending.target = target;
+            pending.moveDuration = duration;
+            ++m_coalescedCount;
+            return true;
+        }
+
+        m_pendingByEntity[character->GetId()] = m_pendingPathRequests.size();
+        m_pendingPathRequests.push_back(PathRequest{character, target, duration, m_nextRequestSequence++, m_time});
         return true;
     }
 
@@ -98,27 +142,24 @@ namespace World {
             return false;
         }
 
-        MovementState* state = GetOrCreateMovementState(character);
-        if (!state) {
-            return false;
+        uint32_t index = FindMover(character);
+        if (index == NPOS) {
+            index = AddMover(character);
+        } else {
+            // Re-path: the previous path's arena entries become garbage
+            m_pathArenaLive -= m_movers.pathLength[index];
         }
 
-        state->character = character;
-        state->currentPath = path;
-        state->currentPathIndex = 0;
-        state->moveDuration = moveDuration;
-        state->moveTime = 0.0f;
-        state->isMoving = true;
-
-        // Start movement to first tile in path
-        if (!path.empty()) {
-            const Engine::TilePosition& firstTile = path[0];
-            state->target = firstTile;
+        m_movers.pathOffset[index] = AllocatePath(path);
+        m_movers.pathLength[index] = static_cast<uint32_t>(path.size());
+        m_movers.pathIndex[index] = 0;
+        m_movers.moveDuration[index] = moveDuration;
+        m_movers.moveTime[index] = 0.0f;
 
-            // Update animation based on direction
-            Engine::TilePosition from = character->GetTilePosition();
-            UpdateCharacterAnimation(*state, from.row, from.col, firstTile.row, firstTile.col);
-        }
+        // Start movement to first tile in path; update animation based on direction
+        const Engine::TilePosition& firstTile = path[0];
+        Engine::TilePosition from = character->GetTilePosition();
+        UpdateCharacterAnimation(index, from.row, from.col, firstTile.row, firstTile.col);
 
         if (m_logger) {
             m_logger->Debug("Character movement started along path with " +
@@ -133,11 +174,12 @@ namespace World {
             return;
         }
 
-        MovementState* state = GetMovementState(character);
-        if (state) {
-            state->isMoving = false;
-            state->currentPath.clear();
-            character->SetAnimation("idle_down");  // Default idle animation
+        CancelPathRequest(character);
+
+        uint32_t index = FindMover(character);
+        if (index != NPOS) {
+            RemoveMover(index);
+            character->SetAnimation(Engine::AnimationAction::Idle, Engine::Direction::Down);  // Default idle animation
 
             if (m_logger) {
                 m_logger->Debug("Character movement stopped");
@@ -145,141 +187,395 @@ namespace World {
         }
     }
 
+    void MovementSystem::OnTileChanged(const Engine::TilePosition& pos) {
+        if (!m_tileMap) {
+            return;
+        }
+        const Engine::Tile* tile = m_tileMap->GetTile(pos.row, pos.col);
+        if (!tile || tile->IsWalkable()) {
+            return;
+        }
+
+        // Paths shared this frame may run through the tile too
+        m_sharedPaths.clear();
+
+        size_t i = 0;
+        while (i < m_movers.character.size()) {
+            const Engine::TilePosition* begin = m_pathArena.data() + m_movers.pathOffset[i];
+            const Engine::TilePosition* end = begin + m_movers.pathLength[i];
+            const Engine::TilePosition* blocked = std::find(begin + m_movers.pathIndex[i], end, pos);
+            if (blocked == end) {
+                ++i;
+                continue;
+            }
+
+            Entities::Character* character = m_movers.character[i];
+            Engine::TilePosition goal = *(end - 1);
+
+            // A newer order still waiting to be served replaces this path
+            // anyway; re-requesting the old goal would overwrite it
+            if (goal != pos && m_pendingByEntity.find(character->GetId()) == m_pendingByEntity.end()) {
+                MoveCharacterToTile(character, goal, m_movers.moveDuration[i]);
+                ++m_repathCount;
+            }
+
+            // Until a new path is served (or if none exists), walk only up
+            // to the tile before the blocked one
+            uint32_t keep = static_cast<uint32_t>(blocked - begin);
+            if (keep <= m_movers.pathIndex[i]) {
+                // Already stepping onto it: stop where we stand
+                RemoveMover(static_cast<uint32_t>(i));
+                character->SetAnimation(Engine::AnimationAction::Idle, Engine::Direction::Down);
+                continue;  // Slot i now holds another mover
+            }
+            m_pathArenaLive -= m_movers.pathLength[i] - keep;
+            m_movers.pathLength[i] = keep;
+            ++i;
+        }
+    }
+
     bool MovementSystem::IsCharacterMoving(const Entities::Character* character) const {
         if (!character) {
             return false;
         }
 
-        const MovementState* state = GetMovementState(character);
-        return state && state->isMoving;
+        return FindMover(character) != NPOS;
     }
 
-    MovementSystem::MovementState* MovementSystem::GetOrCreateMovementState(Entities::Character* character) {
-        if (!character) {
-            return nullptr;
-        }
+    uint32_t MovementSystem::FindMover(const Entities::Character* character) const {
+        if (!character) return NPOS;
+        auto it = m_moverIndex.find(character->GetId());
+        return (it != m_moverIndex.end()) ? it->second : NPOS;
+    }
+
+    uint32_t MovementSystem::AddMover(Entities::Character* character) {
+        uint32_t index = static_cast<uint32_t>(m_movers.character.size());
+        m_movers.character.push_back(character);
+        m_movers.moveTime.push_back(0.0f);
+        m_movers.moveDuration.push_back(0.3f);
+        m_movers.pathOffset.push_back(0);
+        m_movers.pathLength.push_back(0);
+        m_movers.pathIndex.push_back(0);
+        m_movers.lastDirection.push_back(Engine::Direction::Down);
+        m_movers.hasLastDirection.push_back(0);
+        m_moverIndex[character->GetId()] = index;
+        return index;
+    }
 
-        uint32_t id = character->GetId();
-        auto it = m_movingCharacters.find(id);
-        if (it != m_movingCharacters.end()) {
-            return &it->second;
+    void MovementSystem::RemoveMover(uint32_t index) {
+        m_pathArenaLive -= m_movers.pathLength[index];
+        m_moverIndex.erase(m_movers.character[index]->GetId());
+
+        uint32_t last = static_cast<uint32_t>(m_movers.character.size() - 1);
+        if (index != last) {
+            m_movers.character[index] = m_movers.character[last];
+            m_movers.moveTime[index] = m_movers.moveTime[last];
+            m_movers.moveDuration[index] = m_movers.moveDuration[last];
+            m_movers.pathOffset[index] = m_movers.pathOffset[last];
+            m_movers.pathLength[index] = m_movers.pathLength[last];
+            m_movers.pathIndex[index] = m_movers.pathIndex[last];
+            m_movers.lastDirection[index] = m_movers.lastDirection[last];
+            m_movers.hasLastDirection[index] = m_movers.hasLastDirection[last];
+            m_moverIndex[m_movers.character[index]->GetId()] = index;
         }
 
-        // Create new state
-        MovementState& newState = m_movingCharacters[id];
-        newState.character = character;
-        return &newState;
+        m_movers.character.pop_back();
+        m_movers.moveTime.pop_back();
+        m_movers.moveDuration.pop_back();
+        m_movers.pathOffset.pop_back();
+        m_movers.pathLength.pop_back();
+        m_movers.pathIndex.pop_back();
+        m_movers.lastDirection.pop_back();
+        m_movers.hasLastDirection.pop_back();
     }
 
-    MovementSystem::MovementState* MovementSystem::GetMovementState(const Entities::Character* character) {
-        if (!character) return nullptr;
-        auto it = m_movingCharacters.find(character->GetId());
-        return (it != m_movingCharacters.end()) ? &it->second : nullptr;
+    uint32_t MovementSystem::AllocatePath(const Engine::Path& path) {
+        uint32_t offset = static_cast<uint32_t>(m_pathArena.size());
+        m_pathArena.insert(m_pathArena.end(), path.begin(), path.end());
+        m_pathArenaLive += path.size();
+        return offset;
     }
 
-    const MovementSystem::MovementState* MovementSystem::GetMovementState(const Entities::Character* character) const {
-        if (!character) return nullptr;
-        auto it = m_movingCharacters.find(character->GetId());
-        return (it != m_movingCharacters.end()) ? &it->second : nullptr;
+    void MovementSystem::CompactPathArena() {
+        std::vector<Engine::TilePosition> compacted;
+        compacted.reserve(m_pathArenaLive * 2);
+        for (size_t i = 0; i < m_movers.character.size(); ++i) {
+            uint32_t offset = m_movers.pathOffset[i];
+            uint32_t length = m_movers.pathLength[i];
+            m_movers.pathOffset[i] = static_cast<uint32_t>(compacted.size());
+            compacted.insert(compacted.end(), m_pathArena.begin() + offset, m_pathArena.begin() + offset + length);
+        }
+        m_pathArena.swap(compacted);
     }
 
     void MovementSystem::ProcessPathfindingBudget() {
-        if (!m_pathfinder || !m_tileMap) {
+        if (!m_pathfinder || !m_tileMap || m_pendingPathRequests.empty()) {
             return;
         }
 
-        size_t processed = 0;
-        while (processed < MAX_PATHS_PER_FRAME && !m_pendingPathRequests.empty()) {
-            PathRequest request = m_pendingPathRequests.front();
-            m_pendingPathRequests.pop_front();
-
+        // Service order: priority (high first), then age. Priority sits above
+        // the 62-bit sequence so one sort key covers both
+        m_requestOrder.clear();
+        for (size_t i = 0; i < m_pendingPathRequests.size(); ++i) {
+            const PathRequest& request = m_pendingPathRequests[i];
+            PathPriority priority = (m_priorityFn && request.character)
+                ? m_priorityFn(request.character) : PathPriority::Background;
+            uint64_t rank = static_cast<uint64_t>(PathPriority::Selected) - static_cast<uint64_t>(priority);
+            m_requestOrder.emplace_back((rank << 62) | request.sequence, i);
+        }
+        std::sort(m_requestOrder.begin(), m_requestOrder.end());
+
+        m_requestServed.assign(m_pendingPathRequests.size(), 0);
+        m_sharedPaths.clear();
+
+        // Pathfinding bounds-checks every position before asking, so read
+        // the map through unchecked views: the bit plane when the map keeps
+        // one, the tile array otherwise
+        Engine::TileMap::WalkabilityView walkBits = m_tileMap->GetWalkabilityView();
+        Engine::TileMap::TileView tiles = m_tileMap->GetTileView();
+        auto isWalkable = [walkBits, tiles](const Engine::TilePosition& pos) -> bool {
+            return walkBits.words ? walkBits.IsWalkable(pos.row, pos.col) : tiles.At(pos.row, pos.col).IsWalkable();
+        };
+
+        // Once the search budget is spent, keep scanning: requests that can
+        // reuse a path searched this frame are still served
+        size_t searches = 0;
+        for (const auto& entry : m_requestOrder) {
+            PathRequest request = m_pendingPathRequests[entry.second];
             if (!request.character) {
+                m_requestServed[entry.second] = 1;
                 continue;
             }
 
             Engine::TilePosition current = request.character->GetTilePosition();
-            auto isWalkable = [this](const Engine::TilePosition& pos) -> bool {
-                const Engine::Tile* tile = m_tileMap->GetTile(pos.row, pos.col);
-                return tile && tile->IsWalkable();
-            };
+            Engine::Path path;
+            size_t startIndex = 0;
+            if (const SharedPath* shared = FindSharedPath(current, request.target, startIndex)) {
+                if (startIndex == NPOS) {
+                    // Next to the searching unit's start: step onto it first
+                    path.reserve(shared->path.size() + 1);
+                    path.push_back(shared->start);
+                    startIndex = 0;
+                }
+                path.insert(path.end(), shared->path.begin() + startIndex, shared->path.end());
+                ++m_sharedCount;
+            } else if (searches < MAX_PATHS_PER_FRAME) {
+                path = m_pathfinder->FindPath(
+                    current,
+                    request.target,
+                    m_tileMap->GetWidth(),
+                    m_tileMap->GetHeight(),
+                    isWalkable
+                );
+                ++searches;
+                ++m_searchCount;
+                if (!path.empty()) {
+                    m_sharedPaths.push_back(SharedPath{current, request.target, path});
+                }
+            } else {
+                continue;
+            }
 
-            Engine::Path path = m_pathfinder->FindPath(
-                current,
-                request.target,
-                m_tileMap->GetWidth(),
-                m_tileMap->GetHeight(),
-                isWalkable
-            );
+            m_requestServed[entry.second] = 1;
+            RecordLatency(m_time - request.enqueueTime);
 
             if (!path.empty()) {
                 MoveCharacterAlongPath(request.character, path, request.moveDuration);
+                ++m_servedCount;
             } else if (m_logger) {
                 m_logger->Warning("MovementSystem: path request failed");
             }
+        }
+
+        // Drop served requests and rebuild the per-entity index
+        size_t write = 0;
+        m_pendingByEntity.clear();
+        for (size_t i = 0; i < m_pendingPathRequests.size(); ++i) {
+            if (m_requestServed[i]) continue;
+            if (write != i) {
+                m_pendingPathRequests[write] = m_pendingPathRequests[i];
+            }
+            m_pendingByEntity[m_pendingPathRequests[write].character->GetId()] = write;
+            ++write;
+        }
+        m_pendingPathRequests.resize(write);
+    }
+
+    const MovementSystem::SharedPath* MovementSystem::FindSharedPath(
+        const Engine::TilePosition& start,
+        const Engine::TilePosition& target,
+        size_t& startIndex) const {
+
+        for (const SharedPath& shared : m_sharedPaths) {
+            if (shared.target != target) continue;
+
+            if (shared.start == start) {
+                startIndex = 0;
+                return &shared;
+            }
+
+            // Already standing on the path: follow the rest of it
+            for (size_t i = 0; i + 1 < shared.path.size(); ++i) {
+                if (shared.path[i] == start) {
+                    startIndex = i + 1;
+                    return &shared;
+                }
+            }
+        }
 
-            ++processed;
+        // A unit beside a searched start (a group standing together) joins
+        // that path one step behind
+        for (const SharedPath& shared : m_sharedPaths) {
+            if (shared.target != target) continue;
+            int deltaRow = std::abs(static_cast<int>(shared.start.row) - static_cast<int>(start.row));
+            int deltaCol = std::abs(static_cast<int>(shared.start.col) - static_cast<int>(start.col));
+            if (deltaRow + deltaCol == 1) {
+                startIndex = NPOS;
+                return &shared;
+            }
         }
+        return nullptr;
     }
 
-    void MovementSystem::UpdateCharacterMovement(MovementState& state, float deltaTime) {
-        if (!state.character || !state.isMoving) {
+    void MovementSystem::CancelPathRequest(const Entities::Character* character) {
+        auto it = m_pendingByEntity.find(character->GetId());
+        if (it == m_pendingByEntity.end()) {
             return;
         }
 
-        state.moveTime += deltaTime;
+        // Service order comes from the request's sequence, so swap-remove is safe
+        size_t index = it->second;
+        m_pendingByEntity.erase(it);
+        size_t last = m_pendingPathRequests.size() - 1;
+        if (index != last) {
+            m_pendingPathRequests[index] = m_pendingPathRequests[last];
+            m_pendingByEntity[m_pendingPathRequests[index].character->GetId()] = index;
+        }
+        m_pendingPathRequests.pop_back();
+    }
+
+    void MovementSystem::RecordLatency(float latency) {
+        if (m_latencySamples.size() < LATENCY_SAMPLE_COUNT) {
+            m_latencySamples.push_back(latency);
+        } else {
+            m_latencySamples[m_latencyCursor] = latency;
+        }
+        m_latencyCursor = (m_latencyCursor + 1) % LATENCY_SAMPLE_COUNT;
+    }
+
+    PathQueueStats MovementSystem::GetPathQueueStats() const {
+        PathQueueStats stats;
+        stats.pending = m_pendingPathRequests.size();
+        stats.served = m_servedCount;
+        stats.searches = m_searchCount;
+        stats.shared = m_sharedCount;
+        stats.coalesced = m_coalescedCount;
+        stats.repathed = m_repathCount;
+
+        if (!m_latencySamples.empty()) {
+            std::vector<float> sorted(m_latencySamples);
+            std::sort(sorted.begin(), sorted.end());
+            auto percentile = [&sorted](float p) {
+                return sorted[static_cast<size_t>(p * static_cast<float>(sorted.size() - 1) + 0.5f)];
+            };
+            stats.latencyP50 = percentile(0.50f);
+            stats.latencyP95 = percentile(0.95f);
+            stats.latencyP99 = percentile(0.99f);
+            stats.latencyMax = sorted.back();
+        }
+        return stats;
+    }
+
+    void MovementSystem::IntegrateRange(size_t begin, size_t end, float deltaTime, std::vector<StepResult>& steps) {
+        for (size_t i = begin; i < end; ++i) {
+            float& moveTime = m_movers.moveTime[i];
+            moveTime += deltaTime;
+            if (moveTime < m_movers.moveDuration[i]) {
+                continue;
+            }
 
-        if (state.moveTime >= state.moveDuration) {
             // Movement to current tile complete
-            state.moveTime = 0.0f;
-            state.character->SetTilePosition(state.target);
+            moveTime = 0.0f;
+            uint32_t offset = m_movers.pathOffset[i];
+            uint32_t& pathIndex = m_movers.pathIndex[i];
+
+            StepResult step;
+            step.character = m_movers.character[i];
+            step.target = m_pathArena[offset + pathIndex];
+            step.pathOffset = offset;
+            step.direction = m_movers.lastDirection[i];
+            step.turned = false;
+            step.completed = false;
 
             // Check if there's more path to follow
-            if (!state.currentPath.empty() && state.currentPathIndex < state.currentPath.size() - 1) {
-                // Move to next tile in path
-                state.currentPathIndex++;
-                const Engine::TilePosition& nextTile = state.currentPath[state.currentPathIndex];
+            if (pathIndex + 1 < m_movers.pathLength[i]) {
+                ++pathIndex;
+                const Engine::TilePosition& nextTile = m_pathArena[offset + pathIndex];
+                Engine::Direction dir = Engine::DirectionUtil::FromPositions(step.target, nextTile);
+
+                if (!m_movers.hasLastDirection[i] || dir != m_movers.lastDirection[i]) {
+                    m_movers.lastDirection[i] = dir;
+                    m_movers.hasLastDirection[i] = 1;
+                    step.direction = dir;
+                    step.turned = true;
+                }
+            } else {
+                step.completed = true;
+            }
+
+            steps.push_back(step);
+        }
+    }
 
-                Engine::TilePosition current = state.character->GetTilePosition();
-                state.target = nextTile;
+    void MovementSystem::ApplyStep(World* world, const StepResult& step) {
+        Entities::Character* character = step.character;
 
-                // Update animation for new direction
-                UpdateCharacterAnimation(state, current.row, current.col, nextTile.row, nextTile.col);
-            } else {
-                // Path complete
-                state.isMoving = false;
-                state.currentPath.clear();
-                state.hasLastDirection = false;
-                state.character->SetAnimation("idle_down");  // Set to idle
-
-                if (m_logger) {
-                    m_logger->Debug("Character reached destination");
-                }
+        // Keep world occupancy in step with the character's tile
+        if (world->GetCharacterById(character->GetId()) == character) {
+            world->PlaceCharacter(character, step.target);
+        } else {
+            character->SetTilePosition(step.target);
+        }
+
+        // PlaceCharacter publishes events whose handlers may stop or re-path this mover
+        uint32_t index = FindMover(character);
+        if (index == NPOS || m_movers.pathOffset[index] != step.pathOffset) {
+            return;
+        }
+
+        if (step.turned) {
+            character->SetAnimation(Engine::AnimationAction::Walk, step.direction);
+        }
+
+        if (step.completed) {
+            // Path complete
+            character->SetAnimation(Engine::AnimationAction::Idle, Engine::Direction::Down);  // Set to idle
+            RemoveMover(index);
+
+            if (m_logger) {
+                m_logger->Debug("Character reached destination");
             }
         }
     }
 
     void MovementSystem::UpdateCharacterAnimation(
-        MovementState& state,
+        uint32_t index,
         uint16_t fromRow,
         uint16_t fromCol,
         uint16_t toRow,
         uint16_t toCol) {
-        
-        if (!state.character) {
-            return;
-        }
 
         int deltaRow = static_cast<int>(toRow) - static_cast<int>(fromRow);
         int deltaCol = static_cast<int>(toCol) - static_cast<int>(fromCol);
         Engine::Direction dir = Engine::DirectionUtil::FromDelta(deltaRow, deltaCol);
 
-        if (state.hasLastDirection && dir == state.lastDirection) {
+        if (m_movers.hasLastDirection[index] && dir == m_movers.lastDirection[index]) {
             return;
         }
 
-        state.lastDirection = dir;
-        state.hasLastDirection = true;
-        state.character->SetAnimation(Engine::DirectionUtil::ToAnimationName(dir));
+        m_movers.lastDirection[index] = dir;
+        m_movers.hasLastDirection[index] = 1;
+        m_movers.character[index]->SetAnimation(Engine::AnimationAction::Walk, dir);
     }
 
 } // namespace World
@@ -2,13 +2,15 @@
 
 #include "../../../Engine/Core/Types.h"
 #include "../../../Engine/World/Pathfinding.h"
-#include <deque>
+#include <functional>
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 namespace Engine {
     class ILogger;
     class TileMap;
+    class ThreadPool;
 }
 
 namespace LegalCrime {
@@ -18,6 +20,29 @@ namespace Entities {
 namespace World {
     class World;
 
+    /// Path request service order: higher first, then oldest first.
+    enum class PathPriority : uint8_t {
+        Background = 0,
+        Visible = 1,
+        Selected = 2
+    };
+
+    /// Pending path queue health, for monitoring. Latencies are simulation
+    /// seconds from the first order to the path being assigned, over the
+    /// last LATENCY_SAMPLE_COUNT served requests.
+    struct PathQueueStats {
+        size_t pending = 0;
+        size_t served = 0;       // Requests that received a path
+        size_t searches = 0;     // Pathfinder invocations
+        size_t shared = 0;       // Requests served from another request's search
+        size_t coalesced = 0;    // Orders that replaced a still-pending order
+        size_t repathed = 0;     // Paths re-requested because a tile on them was blocked
+        float latencyP50 = 0.0f;
+        float latencyP95 = 0.0f;
+        float latencyP99 = 0.0f;
+        float latencyMax = 0.0f;
+    };
+
     /// <summary>
     /// MovementSystem handles character movement, pathfinding, and tile-based navigation.
     /// Manages movement state, path following, and animation updates for moving characters.
@@ -33,7 +58,8 @@ namespace World {
         // Update all moving characters
         void Update(World* world, float deltaTime);
 
-        // Request character movement to a tile
+        // Request character movement to a tile. Replaces the character's
+        // pending request, if any (the request keeps its original age).
         bool MoveCharacterToTile(
             Entities::Character* character,
             const Engine::TilePosition& target,
@@ -58,58 +84,137 @@ namespace World {
         // Stop character movement immediately
         void StopCharacterMovement(Entities::Character* character);
 
+        // Tile change listener (TileMap::SubscribeTileChanges). When the tile
+        // became unwalkable, movers whose remaining path crosses it have the
+        // path cut just before it (or stop, if already stepping onto it) and
+        // re-request a path to their goal, unless a newer order is already
+        // pending or the goal itself is blocked. Other paths are left alone.
+        void OnTileChanged(const Engine::TilePosition& pos);
+
         // Check if character is currently moving
         bool IsCharacterMoving(const Entities::Character* character) const;
 
+        // Integrate movers on threadCount threads (1 = serial, the default).
+        // Occupancy writes, event publishes and animation switches are buffered
+        // per thread and applied on the calling thread in mover order, so the
+        // outcome of a tick does not depend on the thread count.
+        void SetThreadCount(size_t threadCount);
+        size_t GetThreadCount() const { return m_stepBuffers.size(); }
+
         // Get pathfinder (for external path queries)
         Engine::Pathfinding* GetPathfinder() { return m_pathfinder.get(); }
 
+        // Decides which pending requests are searched first. Without one,
+        // every request is Background and the queue is served oldest first.
+        using PathPriorityFn = std::function<PathPriority(Entities::Character*)>;
+        void SetPathPriorityFn(PathPriorityFn fn) { m_priorityFn = std::move(fn); }
+
         // Visible for tests/debugging.
         size_t GetPendingPathRequestCount() const { return m_pendingPathRequests.size(); }
+        PathQueueStats GetPathQueueStats() const;
 
+        // Pathfinder searches per frame. Requests sharing a goal with a path
+        // searched this frame reuse it without counting against the budget.
         static constexpr size_t MAX_PATHS_PER_FRAME = 5;
+        static constexpr size_t LATENCY_SAMPLE_COUNT = 1024;
+
+        // Below this many movers per thread the tick runs serially.
+        static constexpr size_t MIN_MOVERS_PER_THREAD = 256;
+
+        // Visible for tests/benchmarks.
+        size_t GetActiveMoverCount() const { return m_movers.character.size(); }
+        size_t GetPathArenaSize() const { return m_pathArena.size(); }
 
     private:
-        struct MovementState {
+        static constexpr uint32_t NPOS = UINT32_MAX;
+
+        /// Active movers, structure-of-arrays. Index i across every vector
+        /// describes one mover; completed movers are swap-removed.
+        /// Paths live in m_pathArena as [pathOffset, pathOffset + pathLength).
+        struct Movers {
+            std::vector<Entities::Character*> character;
+            std::vector<float> moveTime;
+            std::vector<float> moveDuration;
+            std::vector<uint32_t> pathOffset;
+            std::vector<uint32_t> pathLength;
+            std::vector<uint32_t> pathIndex;       // Current step within the path
+            std::vector<Engine::Direction> lastDirection;
+            std::vector<uint8_t> hasLastDirection;
+        };
+
+        /// A finished tile step, recorded during integration and applied
+        /// (occupancy, events, animation, removal) in the merge pass.
+        struct StepResult {
             Entities::Character* character;
             Engine::TilePosition target;
-            Engine::Path currentPath;
-            size_t currentPathIndex;
-            float moveTime;
-            float moveDuration;
-            bool isMoving;
-            Engine::Direction lastDirection;
-            bool hasLastDirection;
-
-            MovementState()
-                : character(nullptr)
-                , currentPathIndex(0)
-                , moveTime(0.0f)
-                , moveDuration(0.3f)
-                , isMoving(false)
-                , lastDirection(Engine::Direction::Down)
-                , hasLastDirection(false) {}
+            uint32_t pathOffset;           // Detects re-paths made by event handlers
+            Engine::Direction direction;   // New walk direction when turned
+            bool turned;
+            bool completed;
         };
 
         struct PathRequest {
             Entities::Character* character;
             Engine::TilePosition target;
             float moveDuration;
+            uint64_t sequence;     // Enqueue order; survives coalescing
+            float enqueueTime;     // m_time when first ordered
+        };
+
+        /// A path searched this frame, reusable by requests with the same goal.
+        struct SharedPath {
+            Engine::TilePosition start;
+            Engine::TilePosition target;
+            Engine::Path path;
         };
 
         Engine::ILogger* m_logger;
         Engine::TileMap* m_tileMap;
         std::unique_ptr<Engine::Pathfinding> m_pathfinder;
-        std::deque<PathRequest> m_pendingPathRequests;
-        std::unordered_map<uint32_t, MovementState> m_movingCharacters;  // keyed by entity ID
+        std::vector<PathRequest> m_pendingPathRequests;
+        std::unordered_map<uint32_t, size_t> m_pendingByEntity;  // entity ID → index in m_pendingPathRequests
+        PathPriorityFn m_priorityFn;
+        uint64_t m_nextRequestSequence = 0;
+        float m_time = 0.0f;
+
+        // ProcessPathfindingBudget scratch, reused across frames
+        std::vector<std::pair<uint64_t, size_t>> m_requestOrder;  // (sort key, request index)
+        std::vector<SharedPath> m_sharedPaths;
+        std::vector<uint8_t> m_requestServed;
+
+        // Queue monitoring
+        std::vector<float> m_latencySamples;  // Ring buffer of LATENCY_SAMPLE_COUNT
+        size_t m_latencyCursor = 0;
+        size_t m_servedCount = 0;
+        size_t m_searchCount = 0;
+        size_t m_sharedCount = 0;
+        size_t m_coalescedCount = 0;
+        size_t m_repathCount = 0;
+
+        Movers m_movers;
+        std::unordered_map<uint32_t, uint32_t> m_moverIndex;  // entity ID → mover index (command-time lookups only)
+
+        // Pooled path storage shared by all movers. Append-only; compacted when
+        // dead entries outnumber live ones.
+        std::vector<Engine::TilePosition> m_pathArena;
+        size_t m_pathArenaLive = 0;
+
+        std::unique_ptr<Engine::ThreadPool> m_threadPool;   // Null in serial mode
+        std::vector<std::vector<StepResult>> m_stepBuffers;  // One per thread, reused across ticks
 
         // Internal methods
         void ProcessPathfindingBudget();
-        MovementState* GetOrCreateMovementState(Entities::Character* character);
-        MovementState* GetMovementState(const Entities::Character* character);
-        const MovementState* GetMovementState(const Entities::Character* character) const;
-        void UpdateCharacterMovement(MovementState& state, float deltaTime);
-        void UpdateCharacterAnimation(MovementState& state, uint16_t fromRow, uint16_t fromCol, uint16_t toRow, uint16_t toCol);
+        const SharedPath* FindSharedPath(const Engine::TilePosition& start, const Engine::TilePosition& target, size_t& startIndex) const;
+        void CancelPathRequest(const Entities::Character* character);
+        void RecordLatency(float latency);
+        uint32_t FindMover(const Entities::Character* character) const;
+        uint32_t AddMover(Entities::Character* character);
+        void RemoveMover(uint32_t index);
+        uint32_t AllocatePath(const Engine::Path& path);
+        void CompactPathArena();
+        void IntegrateRange(size_t begin, size_t end, float deltaTime, std::vector<StepResult>& steps);
+        void ApplyStep(World* world, const StepResult& step);
+        void UpdateCharacterAnimation(uint32_t index, uint16_t fromRow, uint16_t fromCol, uint16_t toRow, uint16_t toCol);
     };
 
 } // namespace World
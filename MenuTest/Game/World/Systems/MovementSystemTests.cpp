@@ -4,6 +4,7 @@
 #include "../../Entities/Character.h"
 #include "../../../Engine/World/TileMap.h"
 #include "../../../Engine/Graphics/CharacterSpriteConfig.h"
+#include "../../Events.h"
 
 using namespace LegalCrime::World;
 
@@ -109,3 +110,357 @@ TEST_CASE(MovementSystem_Update_ProcessesPendingRequestsWithinBudget) {
     ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)2);
     return SimpleTest::TestResult{__FUNCTION__, true, ""};
 }
+
+// =============================================================================
+// MovementSystem Tests — dense mover arrays and path arena
+// =============================================================================
+
+TEST_CASE(MovementSystem_AlongPath_CompletesAndSwapRemoves) {
+    MovementSystem sys;
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    Engine::CharacterSpriteConfig config;
+
+    auto* shortWalker = world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+        LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr), Engine::TilePosition(0, 0));
+    auto* longWalker = world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+        LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr), Engine::TilePosition(5, 0));
+
+    Engine::Path shortPath = {Engine::TilePosition(0, 1)};
+    Engine::Path longPath = {Engine::TilePosition(5, 1), Engine::TilePosition(5, 2), Engine::TilePosition(5, 3)};
+    ASSERT_TRUE(sys.MoveCharacterAlongPath(shortWalker, shortPath, 0.1f));
+    ASSERT_TRUE(sys.MoveCharacterAlongPath(longWalker, longPath, 0.1f));
+    ASSERT_EQUAL(sys.GetActiveMoverCount(), (size_t)2);
+
+    sys.Update(&world, 0.1f);
+    ASSERT_FALSE(sys.IsCharacterMoving(shortWalker));
+    ASSERT_TRUE(sys.IsCharacterMoving(longWalker));   // swapped into slot 0
+    ASSERT_EQUAL(sys.GetActiveMoverCount(), (size_t)1);
+    ASSERT_TRUE(world.GetCharacterAtTile(0, 1) == shortWalker);
+
+    sys.Update(&world, 0.1f);
+    sys.Update(&world, 0.1f);
+    ASSERT_FALSE(sys.IsCharacterMoving(longWalker));
+    ASSERT_TRUE(longWalker->GetTilePosition() == Engine::TilePosition(5, 3));
+    ASSERT_TRUE(world.GetCharacterAtTile(5, 3) == longWalker);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(MovementSystem_Repath_And_Stop_ReleaseArena) {
+    MovementSystem sys;
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    Engine::CharacterSpriteConfig config;
+    auto* walker = world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+        LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr), Engine::TilePosition(0, 0));
+
+    Engine::Path path;
+    for (uint16_t i = 1; i <= 50; ++i) path.emplace_back(0, i);
+
+    // Repeated re-pathing leaves garbage that the next Update compacts away
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_TRUE(sys.MoveCharacterAlongPath(walker, path, 1.0f));
+    }
+    ASSERT_EQUAL(sys.GetActiveMoverCount(), (size_t)1);
+    sys.Update(&world, 0.01f);
+    ASSERT_EQUAL(sys.GetPathArenaSize(), (size_t)50);
+
+    sys.StopCharacterMovement(walker);
+    ASSERT_FALSE(sys.IsCharacterMoving(walker));
+    ASSERT_EQUAL(sys.GetActiveMoverCount(), (size_t)0);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+// =============================================================================
+// MovementSystem Tests — parallel integration
+// =============================================================================
+
+namespace {
+    // Runs 1200 movers for 40 ticks on threadCount threads and returns the
+    // EntityMovedEvent stream as (entity index, to.row, to.col) triples.
+    std::vector<int> RunMovementTrace(size_t threadCount, std::vector<Engine::TilePosition>& finalTiles) {
+        LegalCrime::World::World world(2000, 2000, 64, nullptr);
+        MovementSystem sys;
+        sys.SetThreadCount(threadCount);
+        Engine::CharacterSpriteConfig config;
+
+        std::vector<LegalCrime::Entities::Character*> units;
+        for (int i = 0; i < 1200; ++i) {
+            units.push_back(world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+                LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr),
+                Engine::TilePosition(static_cast<uint16_t>(i / 40), static_cast<uint16_t>((i % 40) * 3))));
+        }
+        uint32_t firstId = units[0]->GetId();
+
+        for (size_t i = 0; i < units.size(); ++i) {
+            Engine::TilePosition start = units[i]->GetTilePosition();
+            Engine::Path path;
+            for (uint16_t step = 1; step <= 4 + i % 7; ++step) {
+                path.emplace_back(start.row, static_cast<uint16_t>(start.col + (step & 1)));
+            }
+            sys.MoveCharacterAlongPath(units[i], path, 0.05f + 0.01f * static_cast<float>(i % 3));
+        }
+
+        std::vector<int> trace;
+        size_t sub = LegalCrime::DomainEventBus().Subscribe<LegalCrime::EntityMovedEvent>(
+            [&](const LegalCrime::EntityMovedEvent& e) {
+                trace.push_back(static_cast<int>(e.entityId - firstId));
+                trace.push_back(e.to.row);
+                trace.push_back(e.to.col);
+            });
+        for (int tick = 0; tick < 40; ++tick) {
+            sys.Update(&world, 1.0f / 60.0f);
+        }
+        LegalCrime::DomainEventBus().Unsubscribe<LegalCrime::EntityMovedEvent>(sub);
+
+        for (auto* unit : units) finalTiles.push_back(unit->GetTilePosition());
+        return trace;
+    }
+}
+
+TEST_CASE(MovementSystem_SetThreadCount_ClampsToOne) {
+    MovementSystem sys;
+    ASSERT_EQUAL(sys.GetThreadCount(), (size_t)1);
+    sys.SetThreadCount(4);
+    ASSERT_EQUAL(sys.GetThreadCount(), (size_t)4);
+    sys.SetThreadCount(0);
+    ASSERT_EQUAL(sys.GetThreadCount(), (size_t)1);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(MovementSystem_Parallel_MatchesSerialEventOrder) {
+    std::vector<Engine::TilePosition> serialTiles, parallelTiles;
+    std::vector<int> serial = RunMovementTrace(1, serialTiles);
+    std::vector<int> parallel = RunMovementTrace(4, parallelTiles);
+
+    ASSERT_FALSE(serial.empty());
+    ASSERT_EQUAL(serial.size(), parallel.size());
+    ASSERT_TRUE(serial == parallel);
+    ASSERT_TRUE(serialTiles == parallelTiles);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+// =============================================================================
+// MovementSystem Tests — path request queue
+// =============================================================================
+
+namespace {
+    std::unique_ptr<LegalCrime::Entities::Character> MakeThugAt(uint16_t row, uint16_t col) {
+        Engine::CharacterSpriteConfig config;
+        auto ch = std::make_unique<LegalCrime::Entities::Character>(
+            LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+        ch->SetTilePosition(row, col);
+        return ch;
+    }
+}
+
+TEST_CASE(MovementSystem_PathRequests_NewestOrderReplacesPending) {
+    MovementSystem sys;
+    Engine::TileMap tileMap(10, 10, nullptr);
+    ASSERT_TRUE(tileMap.Initialize(800, 600).success);
+    sys.Initialize(&tileMap);
+    auto unit = MakeThugAt(0, 0);
+
+    for (uint16_t i = 1; i <= 5; ++i) {
+        ASSERT_TRUE(sys.MoveCharacterToTile(unit.get(), Engine::TilePosition(i, 0)));
+    }
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)1);
+    ASSERT_EQUAL(sys.GetPathQueueStats().coalesced, (size_t)4);
+
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    sys.Update(&world, 0.016f);
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)0);
+    ASSERT_EQUAL(sys.GetPathQueueStats().searches, (size_t)1);
+    for (int i = 0; i < 100; ++i) sys.Update(&world, 0.1f);
+    ASSERT_TRUE(unit->GetTilePosition() == Engine::TilePosition(5, 0));
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(MovementSystem_PathRequests_PriorityBeforeAge) {
+    MovementSystem sys;
+    Engine::TileMap tileMap(10, 10, nullptr);
+    ASSERT_TRUE(tileMap.Initialize(800, 600).success);
+    sys.Initialize(&tileMap);
+
+    // Seven background requests queued before one selected unit
+    std::vector<std::unique_ptr<LegalCrime::Entities::Character>> units;
+    for (uint16_t i = 0; i < 8; ++i) {
+        units.push_back(MakeThugAt(0, i));
+        ASSERT_TRUE(sys.MoveCharacterToTile(units.back().get(), Engine::TilePosition(9, i)));
+    }
+    LegalCrime::Entities::Character* selected = units.back().get();
+    sys.SetPathPriorityFn([selected](LegalCrime::Entities::Character* character) {
+        return character == selected ? PathPriority::Selected : PathPriority::Background;
+    });
+
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    sys.Update(&world, 0.016f);
+    ASSERT_TRUE(sys.IsCharacterMoving(selected));
+    for (size_t i = 0; i < 4; ++i) ASSERT_TRUE(sys.IsCharacterMoving(units[i].get()));
+    for (size_t i = 4; i < 7; ++i) ASSERT_FALSE(sys.IsCharacterMoving(units[i].get()));
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)3);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(MovementSystem_PathRequests_GroupSharesOneSearch) {
+    MovementSystem sys;
+    Engine::TileMap tileMap(20, 20, nullptr);
+    ASSERT_TRUE(tileMap.Initialize(800, 600).success);
+    sys.Initialize(&tileMap);
+
+    // Ten units in a line beside each other, all ordered to one tile
+    std::vector<std::unique_ptr<LegalCrime::Entities::Character>> units;
+    for (uint16_t i = 0; i < 10; ++i) {
+        units.push_back(MakeThugAt(2, i));
+    }
+    for (auto& unit : units) {
+        ASSERT_TRUE(sys.MoveCharacterToTile(unit.get(), Engine::TilePosition(15, 5)));
+    }
+
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    sys.Update(&world, 0.016f);
+    PathQueueStats stats = sys.GetPathQueueStats();
+    ASSERT_EQUAL(stats.pending, (size_t)0);
+    ASSERT_EQUAL(stats.served, (size_t)10);
+    ASSERT_TRUE(stats.searches < 10);
+    ASSERT_EQUAL(stats.searches + stats.shared, (size_t)10);
+
+    for (int i = 0; i < 200; ++i) sys.Update(&world, 0.1f);
+    for (auto& unit : units) {
+        ASSERT_TRUE(unit->GetTilePosition() == Engine::TilePosition(15, 5));
+    }
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(MovementSystem_PathRequests_LatencyPercentilesAndStopCancels) {
+    MovementSystem sys;
+    Engine::TileMap tileMap(20, 20, nullptr);
+    ASSERT_TRUE(tileMap.Initialize(800, 600).success);
+    sys.Initialize(&tileMap);
+
+    std::vector<std::unique_ptr<LegalCrime::Entities::Character>> units;
+    for (uint16_t i = 0; i < 20; ++i) {
+        units.push_back(MakeThugAt(0, i));
+        ASSERT_TRUE(sys.MoveCharacterToTile(units.back().get(), Engine::TilePosition(19, static_cast<uint16_t>(19 - i))));
+    }
+    sys.StopCharacterMovement(units[19].get());
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)19);
+
+    // Distinct goals: 5 searches per 0.1s frame => 4 frames for 19 requests
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    for (int i = 0; i < 4; ++i) sys.Update(&world, 0.1f);
+    PathQueueStats stats = sys.GetPathQueueStats();
+    ASSERT_EQUAL(stats.pending, (size_t)0);
+    ASSERT_EQUAL(stats.served, (size_t)19);
+    ASSERT_FLOAT_NEAR(stats.latencyP50, 0.2f, 0.001f);
+    ASSERT_FLOAT_NEAR(stats.latencyMax, 0.4f, 0.001f);
+    ASSERT_TRUE(stats.latencyP95 >= stats.latencyP50);
+    ASSERT_FALSE(sys.IsCharacterMoving(units[19].get()));
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(MovementSystem_OnTileChanged_RepathsOnlyBlockedMovers) {
+    MovementSystem sys;
+    Engine::TileMap tileMap(20, 20, nullptr);
+    ASSERT_TRUE(tileMap.Initialize(800, 600).success);
+    sys.Initialize(&tileMap);
+    size_t sub = tileMap.SubscribeTileChanges([&](const Engine::TilePosition& pos) { sys.OnTileChanged(pos); });
+
+    // Two units walking down separate columns
+    auto left = MakeThugAt(0, 2);
+    auto right = MakeThugAt(0, 15);
+    ASSERT_TRUE(sys.MoveCharacterToTile(left.get(), Engine::TilePosition(19, 2)));
+    ASSERT_TRUE(sys.MoveCharacterToTile(right.get(), Engine::TilePosition(19, 15)));
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    sys.Update(&world, 0.016f);
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)0);
+
+    // A door closes on the left unit's path; re-opening it repaths nobody
+    ASSERT_TRUE(tileMap.SetTileWalkable(10, 2, false));
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)1);
+    ASSERT_EQUAL(sys.GetPathQueueStats().repathed, (size_t)1);
+    sys.Update(&world, 0.016f);
+    ASSERT_TRUE(tileMap.SetTileWalkable(10, 2, true));
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)0);
+    ASSERT_TRUE(tileMap.SetTileWalkable(10, 2, false));
+
+    bool steppedOnWall = false;
+    for (int i = 0; i < 300; ++i) {
+        sys.Update(&world, 0.1f);
+        steppedOnWall = steppedOnWall || left->GetTilePosition() == Engine::TilePosition(10, 2);
+    }
+    ASSERT_FALSE(steppedOnWall);
+    ASSERT_TRUE(left->GetTilePosition() == Engine::TilePosition(19, 2));
+    ASSERT_TRUE(right->GetTilePosition() == Engine::TilePosition(19, 15));
+    tileMap.UnsubscribeTileChanges(sub);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(MovementSystem_OnTileChanged_NewerPendingOrderSurvives) {
+    MovementSystem sys;
+    Engine::TileMap tileMap(20, 20, nullptr);
+    ASSERT_TRUE(tileMap.Initialize(800, 600).success);
+    sys.Initialize(&tileMap);
+    size_t sub = tileMap.SubscribeTileChanges([&](const Engine::TilePosition& pos) { sys.OnTileChanged(pos); });
+
+    auto unit = MakeThugAt(0, 2);
+    ASSERT_TRUE(sys.MoveCharacterToTile(unit.get(), Engine::TilePosition(19, 2)));
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    sys.Update(&world, 0.016f);
+
+    // The player re-orders the unit; before that order is served a door
+    // closes on the old path
+    ASSERT_TRUE(sys.MoveCharacterToTile(unit.get(), Engine::TilePosition(0, 15)));
+    size_t coalesced = sys.GetPathQueueStats().coalesced;
+    ASSERT_TRUE(tileMap.SetTileWalkable(10, 2, false));
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)1);
+    ASSERT_EQUAL(sys.GetPathQueueStats().coalesced, coalesced);
+    ASSERT_EQUAL(sys.GetPathQueueStats().repathed, (size_t)0);
+
+    for (int i = 0; i < 300; ++i) {
+        sys.Update(&world, 0.1f);
+    }
+    ASSERT_TRUE(unit->GetTilePosition() == Engine::TilePosition(0, 15));
+    tileMap.UnsubscribeTileChanges(sub);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(MovementSystem_OnTileChanged_BlockedGoalStopsBeforeIt) {
+    MovementSystem sys;
+    Engine::TileMap tileMap(20, 20, nullptr);
+    ASSERT_TRUE(tileMap.Initialize(800, 600).success);
+    sys.Initialize(&tileMap);
+    size_t sub = tileMap.SubscribeTileChanges([&](const Engine::TilePosition& pos) { sys.OnTileChanged(pos); });
+
+    auto unit = MakeThugAt(0, 2);
+    ASSERT_TRUE(sys.MoveCharacterToTile(unit.get(), Engine::TilePosition(10, 2)));
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    sys.Update(&world, 0.016f);
+
+    // No path can reach a blocked goal: nothing is re-requested, and the
+    // live path ends on the tile before it
+    ASSERT_TRUE(tileMap.SetTileWalkable(10, 2, false));
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)0);
+    ASSERT_EQUAL(sys.GetPathQueueStats().repathed, (size_t)0);
+
+    bool steppedOnWall = false;
+    for (int i = 0; i < 300; ++i) {
+        sys.Update(&world, 0.1f);
+        steppedOnWall = steppedOnWall || unit->GetTilePosition() == Engine::TilePosition(10, 2);
+    }
+    ASSERT_FALSE(steppedOnWall);
+    ASSERT_TRUE(unit->GetTilePosition() == Engine::TilePosition(9, 2));
+    ASSERT_FALSE(sys.IsCharacterMoving(unit.get()));
+
+    // A unit already stepping onto a tile that closes stops where it stands
+    Engine::Path path{ Engine::TilePosition(9, 3), Engine::TilePosition(9, 4), Engine::TilePosition(9, 5) };
+    ASSERT_TRUE(sys.MoveCharacterAlongPath(unit.get(), path));
+    ASSERT_TRUE(sys.IsCharacterMoving(unit.get()));
+    ASSERT_TRUE(tileMap.SetTileWalkable(9, 3, false));
+    ASSERT_FALSE(sys.IsCharacterMoving(unit.get()));
+    ASSERT_EQUAL(sys.GetPendingPathRequestCount(), (size_t)1);
+    for (int i = 0; i < 300; ++i) {
+        sys.Update(&world, 0.1f);
+    }
+    ASSERT_TRUE(unit->GetTilePosition() == Engine::TilePosition(9, 5));
+    tileMap.UnsubscribeTileChanges(sub);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
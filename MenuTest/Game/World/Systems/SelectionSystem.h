@@ -49,6 +49,7 @@ namespace World {
         const std::vector<Entities::Character*>& GetSelectedCharacters() const { return m_selected; }
         bool HasSelection() const { return !m_selected.empty(); }
         size_t GetSelectionCount() const { return m_selected.size(); }
+        bool IsSelected(Entities::Character* character) const;
 
         // Legacy single-selection convenience (returns first selected or nullptr)
         Entities::Character* GetSelectedCharacter();
@@ -84,8 +85,6 @@ namespace World {
         );
 
     private:
-        bool IsSelected(Entities::Character* character) const;
-
         Engine::ILogger* m_logger;
 
         // Multi-selection
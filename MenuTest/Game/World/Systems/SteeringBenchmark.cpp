@@ -0,0 +1,87 @@
+#include "../../../Tests/SimpleTest.h"
+#include "SteeringSystem.h"
+#include "../World.h"
+#include "../../Entities/Character.h"
+#include "../../../Engine/Graphics/CharacterSpriteConfig.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+
+TEST_CASE(SteeringBench_NeighborGrid_100_To_20k) {
+    // Constant density: units on a jittered 24 px lattice, so each unit has
+    // ~8 neighbours inside the 40 px separation radius at every size
+    const int unitCounts[] = {100, 1000, 5000, 20000};
+    const int ticks = 20;
+
+    for (int unitCount : unitCounts) {
+        LegalCrime::World::World world(20000, 20000, 64, nullptr);
+        Engine::CharacterSpriteConfig config;
+        int side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(unitCount))));
+        for (int i = 0; i < unitCount; ++i) {
+            auto* ch = world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+                LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr), Engine::TilePosition(0, 0));
+            ch->SetPosition((i % side) * 24 + (i * 7) % 5, (i / side) * 24 + (i * 13) % 5);
+        }
+
+        LegalCrime::World::SteeringSystem steering;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int tick = 0; tick < ticks; ++tick) {
+            steering.Update(&world, 1.0f / 60.0f);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        std::cout << "  [bench] SteeringSystem " << unitCount << " units: "
+                  << (us / ticks) << " us/tick (" << (us * 1000 / ticks / unitCount) << " ns/unit)" << std::endl;
+        ASSERT_TRUE(us < 20000000);
+    }
+    return {"SteeringBench_NeighborGrid_100_To_20k", true, ""};
+}
+
+TEST_CASE(SteeringBench_ORCA_5k_CrossingStreams) {
+    // Two 2500-unit blocks walking through each other at 100 px/s; the
+    // harness plays the movement layer by writing base positions each tick
+    const int unitCount = 5000;
+    const int ticks = 60;
+    const float dt = 1.0f / 60.0f;
+    const size_t threadCounts[] = {1, 8};
+
+    for (size_t threads : threadCounts) {
+        LegalCrime::World::World world(20000, 20000, 64, nullptr);
+        Engine::CharacterSpriteConfig config;
+        std::vector<LegalCrime::Entities::Character*> units;
+        std::vector<Engine::Point> starts;
+        for (int i = 0; i < unitCount; ++i) {
+            auto* ch = world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+                LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr), Engine::TilePosition(0, 0));
+            int group = i & 1;
+            int slot = i / 2;
+            Engine::Point start(group * 3000 + (slot % 50) * 40, (slot / 50) * 40);
+            ch->SetPosition(start);
+            units.push_back(ch);
+            starts.push_back(start);
+        }
+
+        LegalCrime::World::SteeringSystem steering;
+        steering.SetMode(LegalCrime::World::SteeringMode::ORCA);
+        steering.SetThreadCount(threads);
+
+        long long solveUs = 0;
+        for (int tick = 1; tick <= ticks; ++tick) {
+            int travelled = static_cast<int>(tick * dt * 100.0f);
+            for (int i = 0; i < unitCount; ++i) {
+                int direction = (i & 1) ? -1 : 1;
+                units[i]->SetPosition(starts[i].x + direction * travelled, starts[i].y);
+            }
+            auto start = std::chrono::high_resolution_clock::now();
+            steering.Update(&world, dt);
+            auto end = std::chrono::high_resolution_clock::now();
+            solveUs += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+        }
+
+        std::cout << "  [bench] SteeringSystem ORCA 5k agents, " << threads << " thread(s): "
+                  << (solveUs / ticks) << " us/tick" << std::endl;
+        ASSERT_TRUE(solveUs < 30000000);
+    }
+    return {"SteeringBench_ORCA_5k_CrossingStreams", true, ""};
+}
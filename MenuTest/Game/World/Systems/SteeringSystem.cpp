@@ -3,11 +3,148 @@
 #include "../../Entities/Character.h"
 #include "../../GameConstants.h"
 #include "../../../Engine/Core/Logger/ILogger.h"
+#include "../../../Engine/Core/ThreadPool.h"
+#include <algorithm>
 #include <cmath>
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LEGALCRIME_STEERING_SSE2 1
+#include <emmintrin.h>
+#endif
+
 namespace LegalCrime {
 namespace World {
 
+    namespace {
+
+        // ORCA solver, after van den Berg et al., "Reciprocal n-Body Collision
+        // Avoidance" (agent-agent constraints only; no static obstacles).
+
+        struct Vec2 {
+            float x, y;
+        };
+
+        inline Vec2 operator+(Vec2 a, Vec2 b) { return {a.x + b.x, a.y + b.y}; }
+        inline Vec2 operator-(Vec2 a, Vec2 b) { return {a.x - b.x, a.y - b.y}; }
+        inline Vec2 operator-(Vec2 a) { return {-a.x, -a.y}; }
+        inline Vec2 operator*(float s, Vec2 a) { return {s * a.x, s * a.y}; }
+        inline float Dot(Vec2 a, Vec2 b) { return a.x * b.x + a.y * b.y; }
+        inline float Det(Vec2 a, Vec2 b) { return a.x * b.y - a.y * b.x; }
+        inline float LengthSq(Vec2 a) { return Dot(a, a); }
+        inline Vec2 Normalize(Vec2 a) {
+            float length = std::sqrt(LengthSq(a));
+            return (length > 0.0f) ? (1.0f / length) * a : Vec2{0.0f, 0.0f};
+        }
+
+        constexpr float ORCA_EPSILON = 0.00001f;
+        constexpr int MAX_LINES = Constants::Steering::MAX_ORCA_NEIGHBORS;
+
+        /// Half-plane of permitted velocities: left of point + t * direction.
+        struct OrcaLine {
+            Vec2 point;
+            Vec2 direction;
+        };
+
+        /// Optimise along line lineNo subject to lines [0, lineNo) and the speed circle.
+        bool LinearProgram1(const OrcaLine* lines, int lineNo, float radius, Vec2 optVelocity,
+                            bool directionOpt, Vec2& result) {
+            const OrcaLine& line = lines[lineNo];
+            float dotProduct = Dot(line.point, line.direction);
+            float discriminant = dotProduct * dotProduct + radius * radius - LengthSq(line.point);
+            if (discriminant < 0.0f) {
+                return false;  // Speed circle misses the line
+            }
+
+            float sqrtDiscriminant = std::sqrt(discriminant);
+            float tLeft = -dotProduct - sqrtDiscriminant;
+            float tRight = -dotProduct + sqrtDiscriminant;
+
+            for (int i = 0; i < lineNo; ++i) {
+                float denominator = Det(line.direction, lines[i].direction);
+                float numerator = Det(lines[i].direction, line.point - lines[i].point);
+
+                if (std::fabs(denominator) <= ORCA_EPSILON) {
+                    if (numerator < 0.0f) return false;  // Parallel and on the wrong side
+                    continue;
+                }
+
+                float t = numerator / denominator;
+                if (denominator >= 0.0f) {
+                    tRight = std::min(tRight, t);
+                } else {
+                    tLeft = std::max(tLeft, t);
+                }
+                if (tLeft > tRight) return false;
+            }
+
+            float t;
+            if (directionOpt) {
+                t = (Dot(optVelocity, line.direction) > 0.0f) ? tRight : tLeft;
+            } else {
+                t = std::min(std::max(Dot(line.direction, optVelocity - line.point), tLeft), tRight);
+            }
+            result = line.point + t * line.direction;
+            return true;
+        }
+
+        /// Velocity closest to optVelocity inside the speed circle satisfying
+        /// every line. Returns lineCount on success, else the failing line.
+        int LinearProgram2(const OrcaLine* lines, int lineCount, float radius, Vec2 optVelocity,
+                           bool directionOpt, Vec2& result) {
+            if (directionOpt) {
+                result = radius * optVelocity;
+            } else if (LengthSq(optVelocity) > radius * radius) {
+                result = radius * Normalize(optVelocity);
+            } else {
+                result = optVelocity;
+            }
+
+            for (int i = 0; i < lineCount; ++i) {
+                if (Det(lines[i].direction, lines[i].point - result) > 0.0f) {
+                    Vec2 previous = result;
+                    if (!LinearProgram1(lines, i, radius, optVelocity, directionOpt, result)) {
+                        result = previous;
+                        return i;
+                    }
+                }
+            }
+            return lineCount;
+        }
+
+        /// Infeasible case: minimise the largest constraint violation.
+        void LinearProgram3(const OrcaLine* lines, int lineCount, int beginLine, float radius, Vec2& result) {
+            float distance = 0.0f;
+            OrcaLine projected[MAX_LINES];
+
+            for (int i = beginLine; i < lineCount; ++i) {
+                if (Det(lines[i].direction, lines[i].point - result) <= distance) continue;
+
+                int projectedCount = 0;
+                for (int j = 0; j < i; ++j) {
+                    OrcaLine line;
+                    float determinant = Det(lines[i].direction, lines[j].direction);
+                    if (std::fabs(determinant) <= ORCA_EPSILON) {
+                        if (Dot(lines[i].direction, lines[j].direction) > 0.0f) continue;  // Same direction
+                        line.point = 0.5f * (lines[i].point + lines[j].point);
+                    } else {
+                        line.point = lines[i].point +
+                            (Det(lines[j].direction, lines[i].point - lines[j].point) / determinant) * lines[i].direction;
+                    }
+                    line.direction = Normalize(lines[j].direction - lines[i].direction);
+                    projected[projectedCount++] = line;
+                }
+
+                Vec2 previous = result;
+                Vec2 perpendicular = {-lines[i].direction.y, lines[i].direction.x};
+                if (LinearProgram2(projected, projectedCount, radius, perpendicular, true, result) < projectedCount) {
+                    result = previous;  // Only fails from floating-point error
+                }
+                distance = Det(lines[i].direction, lines[i].point - result);
+            }
+        }
+
+    } // namespace
+
     SteeringSystem::SteeringSystem(float separationRadius, float separationStrength,
                                     Engine::ILogger* logger)
         : m_logger(logger)
@@ -17,41 +154,64 @@ namespace World {
 
     SteeringSystem::~SteeringSystem() = default;
 
+    void SteeringSystem::SetThreadCount(size_t threadCount) {
+        if (threadCount == GetThreadCount()) return;
+        m_threadPool.reset();
+        if (threadCount > 1) {
+            m_threadPool = std::make_unique<Engine::ThreadPool>(threadCount);
+        }
+    }
+
+    size_t SteeringSystem::GetThreadCount() const {
+        return m_threadPool ? m_threadPool->GetThreadCount() : 1;
+    }
+
     void SteeringSystem::Update(World* world, float deltaTime) {
         if (!world || deltaTime <= 0.0f) return;
 
-        auto characters = world->GetAllCharacters();
-        size_t count = characters.size();
-        if (count < 2) return;
+        // Snapshot active units. Every unit steers from its start-of-frame
+        // position, so results don't depend on iteration order
+        const auto& characters = world->GetAllCharacters();
+        m_units.clear();
+        m_posX.clear();
+        m_posY.clear();
+        for (auto* character : characters) {
+            if (!character || !character->IsActive()) continue;
+            Engine::Point pos = character->GetPosition();
+            m_units.push_back(character);
+            m_posX.push_back(static_cast<float>(pos.x));
+            m_posY.push_back(static_cast<float>(pos.y));
+        }
+
+        if (m_mode == SteeringMode::ORCA) {
+            UpdateORCA(deltaTime);
+        } else if (m_units.size() >= 2) {
+            UpdateSeparation(deltaTime);
+        }
+    }
+
+    void SteeringSystem::UpdateSeparation(float deltaTime) {
+        size_t count = m_units.size();
+        m_grid.Build(m_posX.data(), m_posY.data(), count, m_separationRadius);
+        const float* sortedX = m_grid.GetSortedX();
+        const float* sortedY = m_grid.GetSortedY();
 
-        // For each character, compute separation force from nearby characters
         for (size_t i = 0; i < count; ++i) {
-            auto* a = characters[i];
-            if (!a || !a->IsActive() || a->IsMoving()) continue;
+            auto* a = m_units[i];
+            if (a->IsMoving()) continue;
 
-            Engine::Point posA = a->GetPosition();
+            float x = m_posX[i];
+            float y = m_posY[i];
             float pushX = 0.0f, pushY = 0.0f;
-
-            for (size_t j = 0; j < count; ++j) {
-                if (i == j) continue;
-                auto* b = characters[j];
-                if (!b || !b->IsActive()) continue;
-
-                Engine::Point posB = b->GetPosition();
-                float dx = static_cast<float>(posA.x - posB.x);
-                float dy = static_cast<float>(posA.y - posB.y);
-                float dist = std::sqrt(dx * dx + dy * dy);
-
-                if (dist < m_separationRadius && dist > Constants::Steering::MIN_DISTANCE) {
-                    // Normalize direction and scale by inverse distance
-                    float factor = (m_separationRadius - dist) / m_separationRadius;
-                    pushX += (dx / dist) * factor * m_separationStrength;
-                    pushY += (dy / dist) * factor * m_separationStrength;
-                }
-            }
+            m_grid.ForEachNearbyRange(x, y, [&](size_t begin, size_t end) {
+                AccumulateSeparation(sortedX, sortedY, begin, end, x, y, m_separationRadius, pushX, pushY);
+            });
+            pushX *= m_separationStrength;
+            pushY *= m_separationStrength;
 
             // Apply push as pixel offset (scaled by dt)
             if (std::abs(pushX) > Constants::Steering::PUSH_THRESHOLD || std::abs(pushY) > Constants::Steering::PUSH_THRESHOLD) {
+                Engine::Point posA = a->GetPosition();
                 int newX = posA.x + static_cast<int>(pushX * deltaTime);
                 int newY = posA.y + static_cast<int>(pushY * deltaTime);
                 a->SetPosition(newX, newY);
@@ -59,5 +219,248 @@ namespace World {
         }
     }
 
+    void SteeringSystem::UpdateORCA(float deltaTime) {
+        size_t count = m_units.size();
+        ++m_frame;
+
+        m_agentRefs.resize(count);
+        m_velX.resize(count);
+        m_velY.resize(count);
+        m_baseVelX.resize(count);
+        m_baseVelY.resize(count);
+        m_prefX.resize(count);
+        m_prefY.resize(count);
+        m_maxSpeed.resize(count);
+        m_newVelX.resize(count);
+        m_newVelY.resize(count);
+
+        // Recover each unit's base position. If the position still matches
+        // what this system wrote, the movement layer left it alone this tick
+        const float invDt = 1.0f / deltaTime;
+        for (size_t i = 0; i < count; ++i) {
+            auto inserted = m_agents.try_emplace(m_units[i]->GetId());
+            AgentState& agent = inserted.first->second;
+            int x = static_cast<int>(m_posX[i]);
+            int y = static_cast<int>(m_posY[i]);
+            if (inserted.second) {
+                agent.baseX = m_posX[i];
+                agent.baseY = m_posY[i];
+                agent.writtenX = x;
+                agent.writtenY = y;
+            }
+
+            float baseX = agent.baseX, baseY = agent.baseY;
+            if (x != agent.writtenX || y != agent.writtenY) {
+                baseX = m_posX[i];
+                baseY = m_posY[i];
+            }
+            m_baseVelX[i] = (baseX - agent.baseX) * invDt;
+            m_baseVelY[i] = (baseY - agent.baseY) * invDt;
+            agent.baseX = baseX;
+            agent.baseY = baseY;
+            agent.frame = m_frame;
+
+            // Solve from the displayed position; prefer the movement
+            // velocity plus a pull back onto the base
+            m_posX[i] = baseX + agent.offsetX;
+            m_posY[i] = baseY + agent.offsetY;
+            m_prefX[i] = m_baseVelX[i] - agent.offsetX * Constants::Steering::OFFSET_RETURN_RATE;
+            m_prefY[i] = m_baseVelY[i] - agent.offsetY * Constants::Steering::OFFSET_RETURN_RATE;
+            float baseSpeed = std::sqrt(m_baseVelX[i] * m_baseVelX[i] + m_baseVelY[i] * m_baseVelY[i]);
+            m_maxSpeed[i] = std::max(baseSpeed, Constants::Steering::MIN_AVOIDANCE_SPEED);
+            m_velX[i] = agent.velX;
+            m_velY[i] = agent.velY;
+            m_agentRefs[i] = &agent;
+        }
+
+        // Forget units that left the world
+        if (m_agents.size() > count) {
+            for (auto it = m_agents.begin(); it != m_agents.end();) {
+                it = (it->second.frame != m_frame) ? m_agents.erase(it) : std::next(it);
+            }
+        }
+
+        if (count == 0) return;
+
+        // Solve: reads only the snapshot, writes m_newVel[i]
+        m_grid.Build(m_posX.data(), m_posY.data(), count, m_neighborDistance);
+        if (m_threadPool && count >= 256 * m_threadPool->GetThreadCount()) {
+            m_threadPool->ParallelFor(count, [this, deltaTime](size_t begin, size_t end, size_t) {
+                SolveRange(begin, end, deltaTime);
+            });
+        } else {
+            SolveRange(0, count, deltaTime);
+        }
+
+        // Apply: the offset absorbs the difference between the solved
+        // velocity and the movement layer's own
+        for (size_t i = 0; i < count; ++i) {
+            AgentState& agent = *m_agentRefs[i];
+            agent.offsetX += (m_newVelX[i] - m_baseVelX[i]) * deltaTime;
+            agent.offsetY += (m_newVelY[i] - m_baseVelY[i]) * deltaTime;
+            agent.velX = m_newVelX[i];
+            agent.velY = m_newVelY[i];
+
+            int x = static_cast<int>(std::lround(agent.baseX + agent.offsetX));
+            int y = static_cast<int>(std::lround(agent.baseY + agent.offsetY));
+            Engine::Point current = m_units[i]->GetPosition();
+            if (current.x != x || current.y != y) {
+                m_units[i]->SetPosition(x, y);
+            }
+            agent.writtenX = x;
+            agent.writtenY = y;
+        }
+    }
+
+    void SteeringSystem::SolveRange(size_t begin, size_t end, float deltaTime) {
+        const float* sortedX = m_grid.GetSortedX();
+        const float* sortedY = m_grid.GetSortedY();
+        const uint32_t* sortedIndex = m_grid.GetSortedIndex();
+        const float neighborDistSq = m_neighborDistance * m_neighborDistance;
+        const float combinedRadius = 2.0f * m_agentRadius;
+        const float combinedRadiusSq = combinedRadius * combinedRadius;
+        const float invTimeHorizon = 1.0f / m_timeHorizon;
+        const float invTimeStep = 1.0f / deltaTime;
+
+        for (size_t i = begin; i < end; ++i) {
+            const Vec2 position = {m_posX[i], m_posY[i]};
+            const Vec2 velocity = {m_velX[i], m_velY[i]};
+
+            // Nearest MAX_LINES neighbours, kept sorted by distance
+            uint32_t neighbors[MAX_LINES];
+            float neighborDistances[MAX_LINES];
+            int neighborCount = 0;
+            m_grid.ForEachNearbyRange(position.x, position.y, [&](size_t rangeBegin, size_t rangeEnd) {
+                for (size_t k = rangeBegin; k < rangeEnd; ++k) {
+                    uint32_t j = sortedIndex[k];
+                    if (j == i) continue;
+                    float dx = sortedX[k] - position.x;
+                    float dy = sortedY[k] - position.y;
+                    float distSq = dx * dx + dy * dy;
+                    if (distSq >= neighborDistSq) continue;
+                    if (neighborCount == MAX_LINES && distSq >= neighborDistances[MAX_LINES - 1]) continue;
+
+                    int slot = (neighborCount < MAX_LINES) ? neighborCount++ : MAX_LINES - 1;
+                    while (slot > 0 && neighborDistances[slot - 1] > distSq) {
+                        neighbors[slot] = neighbors[slot - 1];
+                        neighborDistances[slot] = neighborDistances[slot - 1];
+                        --slot;
+                    }
+                    neighbors[slot] = j;
+                    neighborDistances[slot] = distSq;
+                }
+            });
+
+            // One half-plane per neighbour; each agent takes half the avoidance
+            OrcaLine lines[MAX_LINES];
+            for (int n = 0; n < neighborCount; ++n) {
+                uint32_t j = neighbors[n];
+                const Vec2 relativePosition = Vec2{m_posX[j], m_posY[j]} - position;
+                const Vec2 relativeVelocity = velocity - Vec2{m_velX[j], m_velY[j]};
+                const float distSq = LengthSq(relativePosition);
+
+                OrcaLine& line = lines[n];
+                Vec2 u;
+                if (distSq > combinedRadiusSq) {
+                    // No collision: project onto the truncated velocity-obstacle cone
+                    const Vec2 w = relativeVelocity - invTimeHorizon * relativePosition;
+                    const float wLengthSq = LengthSq(w);
+                    const float dotProduct = Dot(w, relativePosition);
+
+                    if (dotProduct < 0.0f && dotProduct * dotProduct > combinedRadiusSq * wLengthSq) {
+                        // Project on the cut-off circle
+                        const float wLength = std::sqrt(wLengthSq);
+                        const Vec2 unitW = (1.0f / wLength) * w;
+                        line.direction = {unitW.y, -unitW.x};
+                        u = (combinedRadius * invTimeHorizon - wLength) * unitW;
+                    } else {
+                        // Project on a leg
+                        const float leg = std::sqrt(distSq - combinedRadiusSq);
+                        if (Det(relativePosition, w) > 0.0f) {
+                            line.direction = (1.0f / distSq) * Vec2{
+                                relativePosition.x * leg - relativePosition.y * combinedRadius,
+                                relativePosition.x * combinedRadius + relativePosition.y * leg};
+                        } else {
+                            line.direction = -((1.0f / distSq) * Vec2{
+                                relativePosition.x * leg + relativePosition.y * combinedRadius,
+                                -relativePosition.x * combinedRadius + relativePosition.y * leg});
+                        }
+                        u = Dot(relativeVelocity, line.direction) * line.direction - relativeVelocity;
+                    }
+                } else {
+                    // Already overlapping: separate within one time step
+                    const Vec2 w = relativeVelocity - invTimeStep * relativePosition;
+                    const float wLength = std::sqrt(LengthSq(w));
+                    const Vec2 unitW = (wLength > 0.0f) ? (1.0f / wLength) * w : Vec2{1.0f, 0.0f};
+                    line.direction = {unitW.y, -unitW.x};
+                    u = (combinedRadius * invTimeStep - wLength) * unitW;
+                }
+                line.point = velocity + 0.5f * u;
+            }
+
+            Vec2 result;
+            const Vec2 preferred = {m_prefX[i], m_prefY[i]};
+            int failedLine = LinearProgram2(lines, neighborCount, m_maxSpeed[i], preferred, false, result);
+            if (failedLine < neighborCount) {
+                LinearProgram3(lines, neighborCount, failedLine, m_maxSpeed[i], result);
+            }
+            m_newVelX[i] = result.x;
+            m_newVelY[i] = result.y;
+        }
+    }
+
+    void SteeringSystem::AccumulateSeparation(const float* xs, const float* ys, size_t begin, size_t end,
+                                              float x, float y, float radius, float& pushX, float& pushY) {
+        // Each neighbour within (MIN_DISTANCE, radius) pushes along the unit
+        // vector away from it, scaled by (radius - dist) / radius.
+        // Written as dx * (radius - dist) / (radius * dist), masked, so the
+        // loop has no branches. The unit itself (dist 0) is masked out.
+        const float minDist = Constants::Steering::MIN_DISTANCE;
+        const float radiusSq = radius * radius;
+        const float minDistSq = minDist * minDist;
+        size_t i = begin;
+        float sumX = 0.0f, sumY = 0.0f;
+
+#if defined(LEGALCRIME_STEERING_SSE2)
+        const __m128 vx = _mm_set1_ps(x);
+        const __m128 vy = _mm_set1_ps(y);
+        const __m128 vRadius = _mm_set1_ps(radius);
+        const __m128 vRadiusSq = _mm_set1_ps(radiusSq);
+        const __m128 vMinDistSq = _mm_set1_ps(minDistSq);
+        __m128 accX = _mm_setzero_ps();
+        __m128 accY = _mm_setzero_ps();
+        for (; i + 4 <= end; i += 4) {
+            __m128 dx = _mm_sub_ps(vx, _mm_loadu_ps(xs + i));
+            __m128 dy = _mm_sub_ps(vy, _mm_loadu_ps(ys + i));
+            __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+            __m128 inRange = _mm_and_ps(_mm_cmplt_ps(distSq, vRadiusSq), _mm_cmpgt_ps(distSq, vMinDistSq));
+            __m128 dist = _mm_sqrt_ps(_mm_max_ps(distSq, vMinDistSq));
+            __m128 factor = _mm_div_ps(_mm_sub_ps(vRadius, dist), _mm_mul_ps(vRadius, dist));
+            factor = _mm_and_ps(inRange, factor);
+            accX = _mm_add_ps(accX, _mm_mul_ps(dx, factor));
+            accY = _mm_add_ps(accY, _mm_mul_ps(dy, factor));
+        }
+        alignas(16) float lanesX[4];
+        alignas(16) float lanesY[4];
+        _mm_store_ps(lanesX, accX);
+        _mm_store_ps(lanesY, accY);
+        sumX = (lanesX[0] + lanesX[1]) + (lanesX[2] + lanesX[3]);
+        sumY = (lanesY[0] + lanesY[1]) + (lanesY[2] + lanesY[3]);
+#endif
+
+        for (; i < end; ++i) {
+            float dx = x - xs[i];
+            float dy = y - ys[i];
+            float distSq = dx * dx + dy * dy;
+            float dist = std::sqrt(distSq > minDistSq ? distSq : minDistSq);
+            float factor = (distSq < radiusSq && distSq > minDistSq) ? (radius - dist) / (radius * dist) : 0.0f;
+            sumX += dx * factor;
+            sumY += dy * factor;
+        }
+
+        pushX += sumX;
+        pushY += sumY;
+    }
+
 } // namespace World
 } // namespace LegalCrime
@@ -2,10 +2,16 @@
 
 #include "../../../Engine/Core/Types.h"
 #include "../../GameConstants.h"
+#include "../../../Engine/World/NeighborGrid.h"
+#include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace Engine {
     class ILogger;
+    class ThreadPool;
 }
 
 namespace LegalCrime {
@@ -15,8 +21,23 @@ namespace Entities {
 namespace World {
     class World;
 
+    enum class SteeringMode {
+        Separation,   // Push idle units apart (moving units are left alone)
+        ORCA          // Reciprocal velocity obstacles for every unit
+    };
+
     /// Steering-based local avoidance.
     /// Each frame, applies a small repulsion force so nearby units don't overlap.
+    /// Positions are snapshotted into SoA arrays and bucketed on a NeighborGrid
+    /// (cell = separation radius), so each idle unit only examines nearby cells.
+    ///
+    /// ORCA mode treats the position written by the movement layer as each
+    /// unit's base and keeps a per-unit avoidance offset on top of it. Each
+    /// tick, every unit's preferred velocity is its base velocity plus a pull
+    /// back toward the base. ORCA (optimal reciprocal collision avoidance)
+    /// turns that into a collision-free velocity against the nearest
+    /// neighbours on the grid, and the offset absorbs the difference. Velocity
+    /// solves only read the tick's snapshot, so they run on the thread pool.
     class SteeringSystem {
     public:
         SteeringSystem(float separationRadius = Constants::Steering::DEFAULT_SEPARATION_RADIUS,
@@ -24,19 +45,75 @@ namespace World {
                         Engine::ILogger* logger = nullptr);
         ~SteeringSystem();
 
-        /// Apply separation steering to all units each frame.
+        /// Apply steering to all units each frame.
         void Update(World* world, float deltaTime);
 
+        void SetMode(SteeringMode mode) { m_mode = mode; }
+        SteeringMode GetMode() const { return m_mode; }
+
+        /// Threads used for ORCA velocity solves (1 = serial, the default).
+        void SetThreadCount(size_t threadCount);
+        size_t GetThreadCount() const;
+
+        void SetAgentRadius(float radius) { m_agentRadius = radius; }
+        float GetAgentRadius() const { return m_agentRadius; }
+
+        void SetNeighborDistance(float distance) { m_neighborDistance = distance; }
+        float GetNeighborDistance() const { return m_neighborDistance; }
+
+        void SetTimeHorizon(float seconds) { m_timeHorizon = seconds; }
+        float GetTimeHorizon() const { return m_timeHorizon; }
+
         void SetSeparationRadius(float radius) { m_separationRadius = radius; }
         float GetSeparationRadius() const { return m_separationRadius; }
 
         void SetSeparationStrength(float strength) { m_separationStrength = strength; }
         float GetSeparationStrength() const { return m_separationStrength; }
 
+        /// Separation push (before strength/dt scaling) on a unit at (x, y)
+        /// from the points [begin, end) of xs/ys. SIMD where available.
+        static void AccumulateSeparation(const float* xs, const float* ys, size_t begin, size_t end,
+                                         float x, float y, float radius, float& pushX, float& pushY);
+
     private:
+        /// ORCA bookkeeping per unit, keyed by entity ID.
+        struct AgentState {
+            float baseX = 0.0f, baseY = 0.0f;       // Last position from the movement layer
+            float offsetX = 0.0f, offsetY = 0.0f;   // Avoidance offset applied on top of base
+            float velX = 0.0f, velY = 0.0f;         // Last solved velocity
+            int writtenX = 0, writtenY = 0;         // Position this system last wrote
+            uint32_t frame = 0;                     // Last frame the unit was seen
+        };
+
+        void UpdateSeparation(float deltaTime);
+        void UpdateORCA(float deltaTime);
+        void SolveRange(size_t begin, size_t end, float deltaTime);
+
         Engine::ILogger* m_logger;
         float m_separationRadius;
         float m_separationStrength;
+
+        SteeringMode m_mode = SteeringMode::Separation;
+        float m_agentRadius = Constants::Steering::DEFAULT_AGENT_RADIUS;
+        float m_neighborDistance = Constants::Steering::DEFAULT_NEIGHBOR_DISTANCE;
+        float m_timeHorizon = Constants::Steering::DEFAULT_TIME_HORIZON;
+        std::unique_ptr<Engine::ThreadPool> m_threadPool;  // Null in serial mode
+        std::unordered_map<uint32_t, AgentState> m_agents;
+        uint32_t m_frame = 0;
+
+        // Per-frame snapshot of active units, reused across frames
+        std::vector<Entities::Character*> m_units;
+        std::vector<float> m_posX;
+        std::vector<float> m_posY;
+        Engine::NeighborGrid m_grid;
+
+        // ORCA snapshot (input order, parallel to m_units)
+        std::vector<AgentState*> m_agentRefs;
+        std::vector<float> m_velX, m_velY;           // Previous velocities (reciprocity)
+        std::vector<float> m_baseVelX, m_baseVelY;   // Movement-layer velocity this tick
+        std::vector<float> m_prefX, m_prefY;         // Preferred velocity
+        std::vector<float> m_maxSpeed;
+        std::vector<float> m_newVelX, m_newVelY;     // Solver output
     };
 
 } // namespace World
@@ -0,0 +1,188 @@
+#include "../../../Tests/SimpleTest.h"
+#include "SteeringSystem.h"
+#include "../World.h"
+#include "../../Entities/Character.h"
+#include "../../../Engine/Graphics/CharacterSpriteConfig.h"
+#include <cmath>
+#include <cstdlib>
+
+using namespace LegalCrime::World;
+
+namespace {
+    LegalCrime::Entities::Character* SpawnAt(LegalCrime::World::World& world, int x, int y) {
+        Engine::CharacterSpriteConfig config;
+        auto* ch = world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+            LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr), Engine::TilePosition(0, 0));
+        ch->SetPosition(x, y);
+        return ch;
+    }
+}
+
+TEST_CASE(SteeringSystem_OverlappingIdleUnits_PushApart) {
+    LegalCrime::World::World world(2000, 2000, 64, nullptr);
+    auto* left = SpawnAt(world, 100, 100);
+    auto* right = SpawnAt(world, 110, 100);
+    auto* far = SpawnAt(world, 900, 900);
+
+    SteeringSystem steering(40.0f, 100.0f);
+    steering.Update(&world, 0.1f);
+
+    ASSERT_TRUE(left->GetPosition().x < 100);
+    ASSERT_TRUE(right->GetPosition().x > 110);
+    ASSERT_EQUAL(left->GetPosition().y, 100);
+    ASSERT_EQUAL(far->GetPosition().x, 900);
+    ASSERT_EQUAL(far->GetPosition().y, 900);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(SteeringSystem_AccumulateSeparation_MatchesScalarFormula) {
+    // 13 points: exercises the SIMD body and the scalar tail
+    std::vector<float> xs = {0, 5, -7, 12, 39, 41, 0.05f, -20, 3, 30, -30, 8, 15};
+    std::vector<float> ys = {0, 3, 9, -4, 0, 0, 0, 20, -35, 25, -10, 8, 1};
+    const float radius = 40.0f;
+
+    float expectedX = 0.0f, expectedY = 0.0f;
+    for (size_t j = 0; j < xs.size(); ++j) {
+        float dx = -xs[j], dy = -ys[j];
+        float dist = std::sqrt(dx * dx + dy * dy);
+        if (dist < radius && dist > LegalCrime::Constants::Steering::MIN_DISTANCE) {
+            float factor = (radius - dist) / radius;
+            expectedX += (dx / dist) * factor;
+            expectedY += (dy / dist) * factor;
+        }
+    }
+
+    float pushX = 0.0f, pushY = 0.0f;
+    SteeringSystem::AccumulateSeparation(xs.data(), ys.data(), 0, xs.size(), 0.0f, 0.0f, radius, pushX, pushY);
+    ASSERT_FLOAT_NEAR(pushX, expectedX, 0.0001f);
+    ASSERT_FLOAT_NEAR(pushY, expectedY, 0.0001f);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(SteeringSystem_Grid_MatchesBruteForce) {
+    LegalCrime::World::World world(4000, 4000, 64, nullptr);
+    std::srand(11);
+    std::vector<LegalCrime::Entities::Character*> units;
+    for (int i = 0; i < 400; ++i) {
+        units.push_back(SpawnAt(world, std::rand() % 600, std::rand() % 600));
+    }
+
+    // Brute-force expectation from the same start-of-frame snapshot
+    const float radius = 40.0f, strength = 100.0f, dt = 0.05f;
+    std::vector<Engine::Point> expected;
+    for (auto* a : units) {
+        Engine::Point pa = a->GetPosition();
+        float pushX = 0.0f, pushY = 0.0f;
+        for (auto* b : units) {
+            Engine::Point pb = b->GetPosition();
+            float dx = static_cast<float>(pa.x - pb.x), dy = static_cast<float>(pa.y - pb.y);
+            float dist = std::sqrt(dx * dx + dy * dy);
+            if (dist < radius && dist > LegalCrime::Constants::Steering::MIN_DISTANCE) {
+                float factor = (radius - dist) / radius;
+                pushX += (dx / dist) * factor * strength;
+                pushY += (dy / dist) * factor * strength;
+            }
+        }
+        expected.emplace_back(pa.x + static_cast<int>(pushX * dt), pa.y + static_cast<int>(pushY * dt));
+    }
+
+    SteeringSystem steering(radius, strength);
+    steering.Update(&world, dt);
+
+    // Float summation order differs, so allow a one-pixel truncation difference
+    int mismatches = 0;
+    for (size_t i = 0; i < units.size(); ++i) {
+        Engine::Point p = units[i]->GetPosition();
+        if (std::abs(p.x - expected[i].x) > 1 || std::abs(p.y - expected[i].y) > 1) ++mismatches;
+    }
+    ASSERT_EQUAL(mismatches, 0);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+// =============================================================================
+// SteeringSystem Tests — ORCA mode
+// =============================================================================
+
+namespace {
+    float Distance(const Engine::Point& a, const Engine::Point& b) {
+        float dx = static_cast<float>(a.x - b.x), dy = static_cast<float>(a.y - b.y);
+        return std::sqrt(dx * dx + dy * dy);
+    }
+}
+
+TEST_CASE(SteeringSystem_ORCA_HeadOnUnitsPassWithoutOverlap) {
+    LegalCrime::World::World world(2000, 2000, 64, nullptr);
+    auto* a = SpawnAt(world, 100, 300);
+    auto* b = SpawnAt(world, 500, 302);
+
+    SteeringSystem steering;
+    steering.SetMode(SteeringMode::ORCA);
+    ASSERT_TRUE(steering.GetMode() == SteeringMode::ORCA);
+
+    // Stand-in for the movement layer: overwrite base positions each tick
+    const float dt = 1.0f / 60.0f;
+    float minDistance = 1e9f;
+    for (int tick = 1; tick <= 240; ++tick) {
+        int travelled = std::min(400, static_cast<int>(tick * dt * 100.0f));
+        a->SetPosition(100 + travelled, 300);
+        b->SetPosition(500 - travelled, 302);
+        steering.Update(&world, dt);
+        minDistance = std::min(minDistance, Distance(a->GetPosition(), b->GetPosition()));
+    }
+
+    // Combined radius is 32 px; integer rounding may cost a pixel or two
+    ASSERT_TRUE(minDistance > 28.0f);
+
+    // Once clear, the avoidance offsets relax back onto the base positions
+    for (int tick = 0; tick < 120; ++tick) {
+        a->SetPosition(500, 300);
+        b->SetPosition(100, 302);
+        steering.Update(&world, dt);
+    }
+    ASSERT_TRUE(Distance(a->GetPosition(), Engine::Point(500, 300)) <= 2.0f);
+    ASSERT_TRUE(Distance(b->GetPosition(), Engine::Point(100, 302)) <= 2.0f);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(SteeringSystem_ORCA_IdleOverlapResolves) {
+    LegalCrime::World::World world(2000, 2000, 64, nullptr);
+    auto* a = SpawnAt(world, 300, 300);
+    auto* b = SpawnAt(world, 305, 300);
+
+    SteeringSystem steering;
+    steering.SetMode(SteeringMode::ORCA);
+    for (int tick = 0; tick < 120; ++tick) {
+        steering.Update(&world, 1.0f / 60.0f);
+    }
+    ASSERT_TRUE(Distance(a->GetPosition(), b->GetPosition()) > 24.0f);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
+
+TEST_CASE(SteeringSystem_ORCA_ThreadedMatchesSerial) {
+    std::vector<Engine::Point> results[2];
+    const size_t threadCounts[2] = {1, 4};
+    for (int run = 0; run < 2; ++run) {
+        LegalCrime::World::World world(4000, 4000, 64, nullptr);
+        std::srand(5);
+        std::vector<LegalCrime::Entities::Character*> units;
+        for (int i = 0; i < 1500; ++i) {
+            units.push_back(SpawnAt(world, std::rand() % 1500, std::rand() % 1500));
+        }
+
+        SteeringSystem steering;
+        steering.SetMode(SteeringMode::ORCA);
+        steering.SetThreadCount(threadCounts[run]);
+        ASSERT_EQUAL(steering.GetThreadCount(), threadCounts[run]);
+        for (int tick = 0; tick < 10; ++tick) {
+            steering.Update(&world, 1.0f / 60.0f);
+        }
+        for (auto* unit : units) results[run].push_back(unit->GetPosition());
+    }
+
+    bool identical = results[0].size() == results[1].size();
+    for (size_t i = 0; identical && i < results[0].size(); ++i) {
+        identical = results[0][i].x == results[1][i].x && results[0][i].y == results[1][i].y;
+    }
+    ASSERT_TRUE(identical);
+    return SimpleTest::TestResult{__FUNCTION__, true, ""};
+}
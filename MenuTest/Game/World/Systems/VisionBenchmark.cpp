@@ -0,0 +1,184 @@
+#include "../../../Tests/SimpleTest.h"
+#include "VisionSystem.h"
+#include "FactionVisibility.h"
+#include "../../../Engine/ECS/ComponentStorage.h"
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+TEST_CASE(VisionBench_500Units_FullSweepVsIncremental) {
+    // 500 units on a 256x256 map, radius 8; 50 of them step one tile per tick
+    const uint16_t mapSize = 256;
+    const int unitCount = 500;
+    const uint16_t radius = 8;
+    const int ticks = 100;
+
+    Engine::ECS::ComponentStorage<Engine::TilePosition> tiles;
+    for (int i = 0; i < unitCount; ++i) {
+        tiles.Add(static_cast<Engine::ECS::EntityId>(i + 1),
+                  Engine::TilePosition(static_cast<uint16_t>(20 + (i / 25) * 10), static_cast<uint16_t>(10 + (i % 25) * 9)));
+    }
+    auto stepUnits = [&](int tick) {
+        for (int i = 0; i < 50; ++i) {
+            Engine::ECS::EntityId id = static_cast<Engine::ECS::EntityId>((tick * 50 + i) % unitCount + 1);
+            Engine::TilePosition* tile = tiles.GetMut(id);
+            tile->col = static_cast<uint16_t>(10 + (tile->col - 9) % 230);
+        }
+    };
+
+    LegalCrime::World::VisionSystem fullSweep(mapSize, mapSize);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+        stepUnits(tick);
+        fullSweep.BeginFrame();
+        tiles.ForEach([&](Engine::ECS::EntityId, const Engine::TilePosition& tile) {
+            fullSweep.RevealAround(tile, radius);
+        });
+        fullSweep.ClearChangedTiles();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto fullUs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    LegalCrime::World::VisionSystem incremental(mapSize, mapSize);
+    incremental.UpdateViewers(tiles, radius);
+    size_t changed = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+        stepUnits(tick);
+        incremental.UpdateViewers(tiles, radius);
+        changed += incremental.GetChangedTiles().size();
+        incremental.ClearChangedTiles();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto incrementalUs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "  [bench] VisionSystem 500 units r8, 50 moving: full sweep " << (fullUs / ticks)
+              << " us/tick, incremental " << (incrementalUs / ticks) << " us/tick ("
+              << (changed / ticks) << " changed tiles/tick)" << std::endl;
+
+    // Incremental state must match a from-scratch reveal of the final positions
+    LegalCrime::World::VisionSystem reference(mapSize, mapSize);
+    tiles.ForEach([&](Engine::ECS::EntityId, const Engine::TilePosition& tile) {
+        reference.RevealAround(tile, radius);
+    });
+    bool matches = true;
+    for (uint16_t row = 0; row < mapSize; ++row) {
+        for (uint16_t col = 0; col < mapSize; ++col) {
+            matches = matches && (reference.IsVisible(row, col) == incremental.IsVisible(row, col));
+        }
+    }
+    ASSERT_TRUE(matches);
+    ASSERT_TRUE(incrementalUs < 10000000);
+    return {"VisionBench_500Units_FullSweepVsIncremental", true, ""};
+}
+
+TEST_CASE(VisionBench_500Units_Shadowcast_R12) {
+    // 500 units on a 256x256 map of city blocks (walls every 16 tiles with
+    // doorways), radius 12, full re-cast of every unit each tick
+    const uint16_t mapSize = 256;
+    const int unitCount = 500;
+    const uint16_t radius = 12;
+    const int ticks = 50;
+
+    LegalCrime::World::VisionSystem vision(mapSize, mapSize);
+    for (uint16_t row = 0; row < mapSize; ++row) {
+        for (uint16_t col = 0; col < mapSize; ++col) {
+            bool wallLine = (row % 16 == 0) || (col % 16 == 0);
+            bool doorway = (row % 16 == 8) || (col % 16 == 8);
+            if (wallLine && !doorway) vision.SetTileOpaque(row, col, true);
+        }
+    }
+
+    std::vector<Engine::TilePosition> units;
+    for (int i = 0; i < unitCount; ++i) {
+        uint16_t row = static_cast<uint16_t>(1 + (i * 37) % 254);
+        uint16_t col = static_cast<uint16_t>(1 + (i * 101) % 254);
+        if (row % 16 == 0) ++row;
+        if (col % 16 == 0) ++col;
+        units.emplace_back(row, col);
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+        vision.BeginFrame();
+        for (const Engine::TilePosition& unit : units) {
+            vision.RevealAround(unit, radius);
+        }
+        vision.ClearChangedTiles();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto castUs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    // Same units on open ground for comparison
+    LegalCrime::World::VisionSystem open(mapSize, mapSize);
+    start = std::chrono::high_resolution_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+        open.BeginFrame();
+        for (const Engine::TilePosition& unit : units) {
+            open.RevealAround(unit, radius);
+        }
+        open.ClearChangedTiles();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto discUs = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    std::cout << "  [bench] VisionSystem 500 units r12: shadowcast " << (castUs / ticks)
+              << " us/tick, open disc " << (discUs / ticks) << " us/tick" << std::endl;
+
+    // Walls must actually cut views short
+    size_t openVisible = 0;
+    size_t castVisible = 0;
+    for (uint16_t row = 0; row < mapSize; ++row) {
+        for (uint16_t col = 0; col < mapSize; ++col) {
+            openVisible += open.IsVisible(row, col) ? 1 : 0;
+            castVisible += vision.IsVisible(row, col) ? 1 : 0;
+        }
+    }
+    ASSERT_TRUE(castVisible < openVisible);
+    ASSERT_TRUE(castUs < 10000000);
+    return {"VisionBench_500Units_Shadowcast_R12", true, ""};
+}
+
+TEST_CASE(VisionBench_FactionPlanes_8Factions_256) {
+    // 8 factions on 256x256: per-tick clear, one alliance merge, and counts
+    const uint16_t mapSize = 256;
+    const int ticks = 1000;
+    LegalCrime::World::FactionVisibility fog(mapSize, mapSize, 8);
+    for (uint8_t faction = 0; faction < 8; ++faction) {
+        for (uint32_t i = 0; i < 4000; ++i) {
+            uint32_t index = (i * 2654435761u + faction * 977u) % (mapSize * mapSize);
+            fog.SetVisible(faction, static_cast<uint16_t>(index / mapSize), static_cast<uint16_t>(index % mapSize));
+        }
+    }
+
+    size_t counted = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+        fog.ShareVision(1, 0);
+        for (uint8_t faction = 0; faction < 8; ++faction) {
+            counted += fog.CountVisible(faction) + fog.CountExplored(faction);
+        }
+        fog.BeginFrame(2);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+    size_t queries = 0;
+    start = std::chrono::high_resolution_clock::now();
+    for (int tick = 0; tick < 10; ++tick) {
+        for (uint16_t row = 0; row < mapSize; ++row) {
+            for (uint16_t col = 0; col < mapSize; ++col) {
+                queries += fog.CanSee(static_cast<uint8_t>(row & 7), row, col) ? 1 : 0;
+            }
+        }
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto queryNs = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    std::cout << "  [bench] FactionVisibility 8x256^2: merge+16 counts+clear " << (us * 1000 / ticks)
+              << " ns/tick, CanSee " << (queryNs / (10.0 * mapSize * mapSize)) << " ns/query" << std::endl;
+    ASSERT_TRUE(counted > 0);
+    ASSERT_TRUE(queries > 0);
+    ASSERT_TRUE(us < 10000000);
+    return {"VisionBench_FactionPlanes_8Factions_256", true, ""};
+}
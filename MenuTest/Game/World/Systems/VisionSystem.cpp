@@ -1,5 +1,10 @@
 #include "VisionSystem.h"
 #include "../../../Engine/Core/Logger/ILogger.h"
+#include "../../../Engine/ECS/ComponentStorage.h"
+#include "../../../Engine/World/TileMap.h"
+#include "../World.h"
+#include "../../Entities/Character.h"
+#include "../../Events.h"
 #include <cmath>
 #include <algorithm>
 
@@ -10,39 +15,116 @@ namespace World {
         : m_logger(logger)
         , m_width(mapWidth)
         , m_height(mapHeight)
-        , m_grid(static_cast<size_t>(mapWidth) * mapHeight, TileVisibility::Unexplored) {
+        , m_grid(static_cast<size_t>(mapWidth) * mapHeight, TileVisibility::Unexplored)
+        , m_viewerCount(m_grid.size(), 0)
+        , m_tileMark(m_grid.size(), 0)
+        , m_changeSlot(m_grid.size(), NPOS) {
     }
 
     VisionSystem::~VisionSystem() = default;
 
     void VisionSystem::BeginFrame() {
-        for (auto& v : m_grid) {
-            if (v == TileVisibility::Visible) {
-                v = TileVisibility::Explored;
+        for (size_t i = 0; i < m_grid.size(); ++i) {
+            if (m_grid[i] == TileVisibility::Visible) {
+                SetTileState(i, TileVisibility::Explored);
             }
         }
     }
 
     void VisionSystem::RevealAround(const Engine::TilePosition& center, uint16_t visionRadius) {
-        int r = static_cast<int>(visionRadius);
-        int cr = static_cast<int>(center.row);
-        int cc = static_cast<int>(center.col);
+        ComputeView(center, visionRadius, m_viewScratch);
+        for (uint32_t index : m_viewScratch) {
+            SetTileState(index, TileVisibility::Visible);
+        }
+    }
+
+    void VisionSystem::SetTileMap(const Engine::TileMap* tileMap) {
+        if (!tileMap) {
+            m_opaque.clear();
+        } else {
+            m_opaque.assign(m_grid.size(), 0);
+            uint16_t rows = std::min(m_height, tileMap->GetHeight());
+            uint16_t cols = std::min(m_width, tileMap->GetWidth());
+            if (m_logger && (rows != m_height || cols != m_width)) {
+                m_logger->Warning("VisionSystem: tile map size differs from vision grid");
+            }
+            Engine::TileMap::TileView tiles = tileMap->GetTileView();
+            for (uint16_t row = 0; row < rows; ++row) {
+                const Engine::Tile* line = tiles.Row(row);
+                uint8_t* opaque = &m_opaque[static_cast<size_t>(row) * m_width];
+                for (uint16_t col = 0; col < cols; ++col) {
+                    opaque[col] = line[col].IsWalkable() ? 0 : 1;
+                }
+            }
+        }
+
+        for (Viewer& viewer : m_viewers) {
+            if (!viewer.active) continue;
+            ComputeView(viewer.center, viewer.radius, m_viewScratch);
+            ApplyView(viewer, m_viewScratch);
+        }
+    }
 
-        int minRow = std::max(0, cr - r);
-        int maxRow = std::min(static_cast<int>(m_height) - 1, cr + r);
-        int minCol = std::max(0, cc - r);
-        int maxCol = std::min(static_cast<int>(m_width) - 1, cc + r);
+    void VisionSystem::SetTileOpaque(uint16_t row, uint16_t col, bool opaque) {
+        if (row >= m_height || col >= m_width) return;
+        if (m_opaque.empty()) {
+            if (!opaque) return;
+            m_opaque.assign(m_grid.size(), 0);
+        }
+        uint8_t& cell = m_opaque[static_cast<size_t>(row) * m_width + col];
+        if (cell == static_cast<uint8_t>(opaque ? 1 : 0)) return;
+        cell = opaque ? 1 : 0;
 
-        int r2 = r * r;
+        // Only viewers whose radius reaches the tile can see a difference
+        for (Viewer& viewer : m_viewers) {
+            if (!viewer.active) continue;
+            int dr = static_cast<int>(row) - viewer.center.row;
+            int dc = static_cast<int>(col) - viewer.center.col;
+            int r = viewer.radius;
+            if (dr * dr + dc * dc > r * r) continue;
+            ComputeView(viewer.center, viewer.radius, m_viewScratch);
+            ApplyView(viewer, m_viewScratch);
+        }
+    }
 
-        for (int row = minRow; row <= maxRow; ++row) {
-            for (int col = minCol; col <= maxCol; ++col) {
-                int dr = row - cr;
-                int dc = col - cc;
-                if (dr * dr + dc * dc <= r2) {
-                    m_grid[static_cast<size_t>(row) * m_width + col] = TileVisibility::Visible;
+    bool VisionSystem::IsTileOpaque(uint16_t row, uint16_t col) const {
+        if (m_opaque.empty() || row >= m_height || col >= m_width) return false;
+        return m_opaque[static_cast<size_t>(row) * m_width + col] != 0;
+    }
+
+    void VisionSystem::ComputeView(const Engine::TilePosition& center, uint16_t visionRadius,
+                                   std::vector<uint32_t>& out) {
+        out.clear();
+        if (center.row >= m_height || center.col >= m_width) return;
+
+        const std::vector<uint16_t>& extents = GetDiscExtents(visionRadius);
+        int cr = static_cast<int>(center.row);
+        int cc = static_cast<int>(center.col);
+        int r = static_cast<int>(visionRadius);
+
+        if (m_opaque.empty()) {
+            // Open ground: the clipped disc, one row span at a time
+            int minRow = std::max(0, cr - r);
+            int maxRow = std::min(static_cast<int>(m_height) - 1, cr + r);
+            for (int row = minRow; row <= maxRow; ++row) {
+                int extent = extents[static_cast<size_t>(std::abs(row - cr))];
+                int minCol = std::max(0, cc - extent);
+                int maxCol = std::min(static_cast<int>(m_width) - 1, cc + extent);
+                for (int col = minCol; col <= maxCol; ++col) {
+                    out.push_back(static_cast<uint32_t>(row) * m_width + col);
                 }
             }
+            return;
+        }
+
+        // Quadrant edges share tiles; the mark stamps each tile once
+        if (++m_markGeneration == 0) {
+            std::fill(m_tileMark.begin(), m_tileMark.end(), 0u);
+            m_markGeneration = 1;
+        }
+        MarkVisible(static_cast<size_t>(cr) * m_width + cc, out);
+        for (int quadrant = 0; quadrant < 4; ++quadrant) {
+            CastQuadrant(cr, cc, quadrant, 1, -1, 1, 1, 1, extents, out);
         }
     }
 
@@ -65,11 +147,263 @@ namespace World {
     }
 
     void VisionSystem::RevealAll() {
-        std::fill(m_grid.begin(), m_grid.end(), TileVisibility::Visible);
+        for (size_t i = 0; i < m_grid.size(); ++i) {
+            SetTileState(i, TileVisibility::Visible);
+        }
     }
 
     void VisionSystem::Reset() {
-        std::fill(m_grid.begin(), m_grid.end(), TileVisibility::Unexplored);
+        for (size_t i = 0; i < m_grid.size(); ++i) {
+            SetTileState(i, TileVisibility::Unexplored);
+        }
+        std::fill(m_viewerCount.begin(), m_viewerCount.end(), static_cast<uint16_t>(0));
+        m_viewers.clear();
+        // Next UpdateViewers re-places every unit, not only those that moved
+        m_lastTileTick = 0;
+    }
+
+    void VisionSystem::SetViewer(uint32_t viewerId, const Engine::TilePosition& center, uint16_t visionRadius) {
+        if (viewerId >= m_viewers.size()) {
+            m_viewers.resize(static_cast<size_t>(viewerId) + 1);
+        }
+        Viewer& viewer = m_viewers[viewerId];
+        if (viewer.active && viewer.center == center && viewer.radius == visionRadius) {
+            return;
+        }
+
+        ComputeView(center, visionRadius, m_viewScratch);
+        ApplyView(viewer, m_viewScratch);
+        viewer.center = center;
+        viewer.radius = visionRadius;
+        viewer.active = true;
+    }
+
+    void VisionSystem::RemoveViewer(uint32_t viewerId) {
+        if (!HasViewer(viewerId)) return;
+        Viewer& viewer = m_viewers[viewerId];
+
+        for (uint32_t index : viewer.tiles) {
+            RemoveTileViewer(index);
+        }
+        viewer.tiles.clear();
+        viewer.active = false;
+    }
+
+    bool VisionSystem::HasViewer(uint32_t viewerId) const {
+        return viewerId < m_viewers.size() && m_viewers[viewerId].active;
+    }
+
+    uint16_t VisionSystem::GetViewerCount(uint16_t row, uint16_t col) const {
+        if (row >= m_height || col >= m_width) return 0;
+        return m_viewerCount[static_cast<size_t>(row) * m_width + col];
+    }
+
+    void VisionSystem::UpdateViewers(Engine::ECS::ComponentStorage<Engine::TilePosition>& tiles, uint16_t visionRadius) {
+        // Removals first: an ID removed and re-added shows up in both, and
+        // the Changed pass then places it fresh
+        tiles.ForEach(Engine::ECS::Removed<Engine::TilePosition>{m_lastTileTick}, [&](Engine::ECS::EntityId id) {
+            if (!tiles.Has(id)) {
+                RemoveViewer(id);
+            }
+        });
+        tiles.ForEach(Engine::ECS::Changed<Engine::TilePosition>{m_lastTileTick},
+            [&](Engine::ECS::EntityId id, const Engine::TilePosition& tile) {
+                SetViewer(id, tile, visionRadius);
+            });
+        m_lastTileTick = tiles.AdvanceTick();
+    }
+
+    void VisionSystem::ClearChangedTiles() {
+        for (const Engine::TilePosition& tile : m_changedTiles) {
+            m_changeSlot[static_cast<size_t>(tile.row) * m_width + tile.col] = NPOS;
+        }
+        m_changedTiles.clear();
+        m_changedFrom.clear();
+    }
+
+    void VisibilityChanges::Clear() {
+        becameVisible.clear();
+        becameHidden.clear();
+        firstExplored.clear();
+        forgotten.clear();
+    }
+
+    const VisibilityChanges& VisionSystem::FlushChanges() {
+        m_changes.Clear();
+        for (size_t i = 0; i < m_changedTiles.size(); ++i) {
+            const Engine::TilePosition& tile = m_changedTiles[i];
+            TileVisibility from = m_changedFrom[i];
+            TileVisibility now = m_grid[static_cast<size_t>(tile.row) * m_width + tile.col];
+            if (now == TileVisibility::Visible) {
+                m_changes.becameVisible.push_back(tile);
+                if (from == TileVisibility::Unexplored) {
+                    m_changes.firstExplored.push_back(tile);
+                }
+            } else if (now == TileVisibility::Explored) {
+                m_changes.becameHidden.push_back(tile);
+            } else {
+                m_changes.forgotten.push_back(tile);
+            }
+        }
+        ClearChangedTiles();
+        return m_changes;
+    }
+
+    void VisionSystem::PublishSpottedUnits(const World& world) const {
+        for (const Engine::TilePosition& tile : m_changes.becameVisible) {
+            if (!world.IsOccupied(tile)) continue;
+            for (Entities::Character* character : world.GetCharactersAtTile(tile)) {
+                DomainEventBus().Publish(UnitSpottedEvent{character->GetId(), tile});
+            }
+        }
+    }
+
+    void VisionSystem::SetTileState(size_t index, TileVisibility state) {
+        TileVisibility& current = m_grid[index];
+        if (current == state) return;
+
+        uint32_t slot = m_changeSlot[index];
+        if (slot == NPOS) {
+            m_changeSlot[index] = static_cast<uint32_t>(m_changedTiles.size());
+            m_changedTiles.emplace_back(static_cast<uint16_t>(index / m_width), static_cast<uint16_t>(index % m_width));
+            m_changedFrom.push_back(current);
+        } else if (m_changedFrom[slot] == state) {
+            // Back where it started: unlist (swap-remove)
+            uint32_t last = static_cast<uint32_t>(m_changedTiles.size() - 1);
+            if (slot != last) {
+                m_changedTiles[slot] = m_changedTiles[last];
+                m_changedFrom[slot] = m_changedFrom[last];
+                const Engine::TilePosition& moved = m_changedTiles[slot];
+                m_changeSlot[static_cast<size_t>(moved.row) * m_width + moved.col] = slot;
+            }
+            m_changedTiles.pop_back();
+            m_changedFrom.pop_back();
+            m_changeSlot[index] = NPOS;
+        }
+        current = state;
+    }
+
+    void VisionSystem::AddTileViewer(size_t index) {
+        if (m_viewerCount[index]++ == 0) {
+            SetTileState(index, TileVisibility::Visible);
+        }
+    }
+
+    void VisionSystem::RemoveTileViewer(size_t index) {
+        if (--m_viewerCount[index] == 0) {
+            SetTileState(index, TileVisibility::Explored);
+        }
+    }
+
+    void VisionSystem::ApplyView(Viewer& viewer, std::vector<uint32_t>& view) {
+        // Stamp the old view, then re-stamp the tiles the new view keeps;
+        // whatever still carries the first stamp has left the view
+        if (m_markGeneration >= UINT32_MAX - 2) {
+            std::fill(m_tileMark.begin(), m_tileMark.end(), 0u);
+            m_markGeneration = 0;
+        }
+        uint32_t oldMark = ++m_markGeneration;
+        uint32_t keptMark = ++m_markGeneration;
+
+        for (uint32_t index : viewer.tiles) {
+            m_tileMark[index] = oldMark;
+        }
+        for (uint32_t index : view) {
+            if (m_tileMark[index] == oldMark) {
+                m_tileMark[index] = keptMark;
+            } else {
+                AddTileViewer(index);
+            }
+        }
+        for (uint32_t index : viewer.tiles) {
+            if (m_tileMark[index] == oldMark) {
+                RemoveTileViewer(index);
+            }
+        }
+        viewer.tiles.swap(view);
+    }
+
+    const std::vector<uint16_t>& VisionSystem::GetDiscExtents(uint16_t radius) {
+        if (radius >= m_discExtents.size()) {
+            m_discExtents.resize(static_cast<size_t>(radius) + 1);
+        }
+        std::vector<uint16_t>& extents = m_discExtents[radius];
+        if (extents.empty()) {
+            // Same disc as dr*dr + dc*dc <= r*r, one row offset at a time
+            int r2 = static_cast<int>(radius) * radius;
+            extents.resize(static_cast<size_t>(radius) + 1);
+            int extent = radius;
+            for (int depth = 0; depth <= radius; ++depth) {
+                while (depth * depth + extent * extent > r2) --extent;
+                extents[static_cast<size_t>(depth)] = static_cast<uint16_t>(extent);
+            }
+        }
+        return extents;
+    }
+
+    namespace {
+        // Floor division for a positive divisor
+        int FloorDiv(int num, int den) {
+            return (num >= 0) ? num / den : -((-num + den - 1) / den);
+        }
+    }
+
+    void VisionSystem::CastQuadrant(int originRow, int originCol, int quadrant, int depth,
+                                    int startNum, int startDen, int endNum, int endDen,
+                                    const std::vector<uint16_t>& extents, std::vector<uint32_t>& out) {
+        // One row of a quadrant (0 north, 1 south, 2 east, 3 west) at depth,
+        // between slopes start and end (exact fractions, den > 0). Slopes are
+        // column / depth through tile edges, so rounding stays symmetric.
+        if (depth >= static_cast<int>(extents.size())) return;
+
+        // First column: depth * start rounded half up; last: depth * end rounded half down
+        int minCol = FloorDiv(2 * depth * startNum + startDen, 2 * startDen);
+        int maxCol = -FloorDiv(-(2 * depth * endNum - endDen), 2 * endDen);
+        int extent = extents[static_cast<size_t>(depth)];
+        minCol = std::max(minCol, -extent);
+        maxCol = std::min(maxCol, extent);
+
+        int prev = -1;  // -1 none yet, 0 floor, 1 wall
+        for (int col = minCol; col <= maxCol; ++col) {
+            int row, column;
+            switch (quadrant) {
+                case 0:  row = originRow - depth; column = originCol + col; break;
+                case 1:  row = originRow + depth; column = originCol + col; break;
+                case 2:  row = originRow + col;   column = originCol + depth; break;
+                default: row = originRow + col;   column = originCol - depth; break;
+            }
+            bool inside = row >= 0 && row < static_cast<int>(m_height)
+                       && column >= 0 && column < static_cast<int>(m_width);
+            size_t index = inside ? static_cast<size_t>(row) * m_width + column : 0;
+            int wall = (!inside || m_opaque[index]) ? 1 : 0;
+
+            // Floor tiles need their centre inside the slopes; walls show if touched
+            bool symmetric = col * startDen >= depth * startNum && col * endDen <= depth * endNum;
+            if (inside && (wall || symmetric)) {
+                MarkVisible(index, out);
+            }
+
+            if (prev == 1 && !wall) {
+                startNum = 2 * col - 1;
+                startDen = 2 * depth;
+            }
+            if (prev == 0 && wall) {
+                CastQuadrant(originRow, originCol, quadrant, depth + 1,
+                             startNum, startDen, 2 * col - 1, 2 * depth, extents, out);
+            }
+            prev = wall;
+        }
+        if (prev == 0) {
+            CastQuadrant(originRow, originCol, quadrant, depth + 1,
+                         startNum, startDen, endNum, endDen, extents, out);
+        }
+    }
+
+    void VisionSystem::MarkVisible(size_t index, std::vector<uint32_t>& out) {
+        if (m_tileMark[index] != m_markGeneration) {
+            m_tileMark[index] = m_markGeneration;
+            out.push_back(static_cast<uint32_t>(index));
+        }
     }
 
 } // namespace World
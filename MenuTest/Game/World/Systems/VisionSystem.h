@@ -6,11 +6,17 @@
 
 namespace Engine {
     class ILogger;
+    class TileMap;
+namespace ECS {
+    template<typename T> class ComponentStorage;
+}
 }
 
 namespace LegalCrime {
 namespace World {
 
+    class World;
+
     /// Per-tile visibility state for fog of war.
     enum class TileVisibility : uint8_t {
         Unexplored = 0,  // Never seen
@@ -18,9 +24,39 @@ namespace World {
         Visible    = 2   // Currently in view
     };
 
+    /// Net visibility transitions since the previous FlushChanges. Every
+    /// tile appears in at most one of becameVisible / becameHidden /
+    /// forgotten; firstExplored is the part of becameVisible never seen before.
+    struct VisibilityChanges {
+        std::vector<Engine::TilePosition> becameVisible;  // Now Visible
+        std::vector<Engine::TilePosition> becameHidden;   // Was Visible, now Explored
+        std::vector<Engine::TilePosition> firstExplored;  // Unexplored -> Visible
+        std::vector<Engine::TilePosition> forgotten;      // Now Unexplored (Reset)
+
+        bool Empty() const { return becameVisible.empty() && becameHidden.empty() && forgotten.empty(); }
+        void Clear();
+    };
+
     /// VisionSystem manages per-tile visibility for fog of war.
-    /// Each frame, all tiles are demoted from Visible → Explored,
-    /// then units reveal tiles within their vision radius.
+    ///
+    /// Full-sweep mode: each frame BeginFrame demotes every Visible tile to
+    /// Explored, then RevealAround re-reveals each unit's radius.
+    ///
+    /// Incremental mode: viewers are registered with SetViewer/RemoveViewer
+    /// (or UpdateViewers from the character tile storage) and each tile keeps
+    /// a viewer count. Moving a viewer only touches the tiles entering or
+    /// leaving its view; a tile is Visible while its count is non-zero.
+    /// Don't mix BeginFrame with viewers.
+    ///
+    /// Either way, tiles whose state changed since ClearChangedTiles are
+    /// listed in GetChangedTiles, so renderers can update just those.
+    /// FlushChanges sorts that list into a per-tick VisibilityChanges for
+    /// FogOfWarRenderer, Minimap and PublishSpottedUnits.
+    ///
+    /// Line of sight: without a tile map a viewer sees its whole disc. With
+    /// SetTileMap, non-walkable tiles block sight and views come from
+    /// symmetric shadowcasting (A sees B exactly when B sees A); blocking
+    /// tiles themselves are revealed. Disc extents are precomputed per radius.
     class VisionSystem {
     public:
         VisionSystem(uint16_t mapWidth, uint16_t mapHeight, Engine::ILogger* logger = nullptr);
@@ -32,6 +68,20 @@ namespace World {
         /// Reveal tiles around a position with the given vision radius.
         void RevealAround(const Engine::TilePosition& center, uint16_t visionRadius);
 
+        /// Take opacity from a tile map (non-walkable = opaque), or nullptr
+        /// to see through everything. Viewers are re-cast. The map is only
+        /// read here; call SetTileOpaque when tiles change afterwards.
+        void SetTileMap(const Engine::TileMap* tileMap);
+
+        /// Change one tile's opacity and re-cast viewers that can reach it.
+        void SetTileOpaque(uint16_t row, uint16_t col, bool opaque);
+        bool IsTileOpaque(uint16_t row, uint16_t col) const;
+
+        /// Tiles (row * width + col) seen from center within radius, each once.
+        /// Replaces the contents of out.
+        void ComputeView(const Engine::TilePosition& center, uint16_t visionRadius,
+                         std::vector<uint32_t>& out);
+
         /// Get the visibility state of a tile.
         TileVisibility GetVisibility(uint16_t row, uint16_t col) const;
         TileVisibility GetVisibility(const Engine::TilePosition& pos) const;
@@ -43,17 +93,95 @@ namespace World {
         /// Make every tile visible (debug / reveal-all cheat).
         void RevealAll();
 
-        /// Reset everything to Unexplored.
+        /// Reset everything to Unexplored and drop all viewers. The next
+        /// UpdateViewers restores a viewer for every unit in the storage.
         void Reset();
 
+        // --- Incremental mode ---
+
+        /// Place or move viewer viewerId (any small integer, e.g. an ECS EntityId).
+        /// Moving adds the tiles newly in view before removing the ones left
+        /// behind, so tiles seen from both positions never flicker.
+        void SetViewer(uint32_t viewerId, const Engine::TilePosition& center, uint16_t visionRadius);
+
+        /// Remove a viewer; tiles nobody else sees become Explored.
+        void RemoveViewer(uint32_t viewerId);
+
+        bool HasViewer(uint32_t viewerId) const;
+        uint16_t GetViewerCount(uint16_t row, uint16_t col) const;
+
+        /// Sync viewers with a tile-position storage using its change filters:
+        /// entities whose tile changed since the last call move their view,
+        /// removed entities drop theirs. Unmoved units cost nothing.
+        void UpdateViewers(Engine::ECS::ComponentStorage<Engine::TilePosition>& tiles, uint16_t visionRadius);
+
+        // --- Change list ---
+
+        /// Tiles whose visibility differs from what it was at the last
+        /// ClearChangedTiles. A tile that changes and changes back is dropped.
+        const std::vector<Engine::TilePosition>& GetChangedTiles() const { return m_changedTiles; }
+        void ClearChangedTiles();
+
+        /// Classify the changed tiles into GetChanges() and clear the change
+        /// list. Call once per tick after all reveals.
+        const VisibilityChanges& FlushChanges();
+        const VisibilityChanges& GetChanges() const { return m_changes; }
+
+        /// Publish UnitSpottedEvent on DomainEventBus for every character
+        /// standing on a tile in GetChanges().becameVisible. Units that walk
+        /// into tiles already in view come through EntityMovedEvent instead.
+        void PublishSpottedUnits(const World& world) const;
+
         uint16_t GetWidth() const { return m_width; }
         uint16_t GetHeight() const { return m_height; }
 
     private:
+        static constexpr uint32_t NPOS = UINT32_MAX;
+
+        struct Viewer {
+            Engine::TilePosition center;
+            uint16_t radius = 0;
+            bool active = false;
+            std::vector<uint32_t> tiles;  // Current view, from ComputeView
+        };
+
+        void SetTileState(size_t index, TileVisibility state);
+        void AddTileViewer(size_t index);
+        void RemoveTileViewer(size_t index);
+
+        /// Swap a viewer's tile list for view, adding before removing.
+        void ApplyView(Viewer& viewer, std::vector<uint32_t>& view);
+
+        /// extents[depth] = widest column offset inside the radius disc at that row offset.
+        const std::vector<uint16_t>& GetDiscExtents(uint16_t radius);
+
+        void CastQuadrant(int originRow, int originCol, int quadrant, int depth,
+                          int startNum, int startDen, int endNum, int endDen,
+                          const std::vector<uint16_t>& extents, std::vector<uint32_t>& out);
+        void MarkVisible(size_t index, std::vector<uint32_t>& out);
+
         Engine::ILogger* m_logger;
         uint16_t m_width;
         uint16_t m_height;
         std::vector<TileVisibility> m_grid; // row-major: m_grid[row * width + col]
+
+        // Incremental mode
+        std::vector<uint16_t> m_viewerCount;  // Per tile
+        std::vector<Viewer> m_viewers;        // Indexed by viewer ID
+        uint32_t m_lastTileTick = 0;          // UpdateViewers change-filter cursor
+
+        // Line of sight
+        std::vector<uint8_t> m_opaque;                    // Per tile; empty = no blockers
+        std::vector<std::vector<uint16_t>> m_discExtents; // Indexed by radius, built on demand
+        std::vector<uint32_t> m_tileMark;                 // Per tile stamp for dedupe / diffing
+        uint32_t m_markGeneration = 0;
+        std::vector<uint32_t> m_viewScratch;
+
+        // Change list; m_changeSlot[tile] is the tile's entry or NPOS
+        std::vector<Engine::TilePosition> m_changedTiles;
+        std::vector<TileVisibility> m_changedFrom;
+        std::vector<uint32_t> m_changeSlot;
+        VisibilityChanges m_changes;
     };
 
 } // namespace World
@@ -1,5 +1,12 @@
 #include "../../Tests/SimpleTest.h"
 #include "Game/World/Systems/VisionSystem.h"
+#include "Engine/ECS/ComponentStorage.h"
+#include "Engine/World/TileMap.h"
+#include "Engine/Graphics/CharacterSpriteConfig.h"
+#include "Game/World/World.h"
+#include "Game/Entities/Character.h"
+#include "Game/Events.h"
+#include <algorithm>
 
 TEST_CASE(VisionSystem_StartsUnexplored) {
     LegalCrime::World::VisionSystem vis(10, 10);
@@ -84,3 +91,259 @@ TEST_CASE(VisionSystem_CircularReveal) {
     ASSERT_TRUE(vis.IsVisible(12, 10));
     return {"VisionSystem_CircularReveal", true, ""};
 }
+
+// =============================================================================
+// Incremental mode
+// =============================================================================
+
+TEST_CASE(VisionSystem_SetViewer_RefCountsOverlap) {
+    LegalCrime::World::VisionSystem vis(30, 30);
+    vis.SetViewer(1, Engine::TilePosition(10, 10), 3);
+    vis.SetViewer(2, Engine::TilePosition(10, 13), 3);
+    ASSERT_TRUE(vis.HasViewer(1));
+    ASSERT_EQUAL(vis.GetViewerCount(10, 11), (uint16_t)2);
+    ASSERT_EQUAL(vis.GetViewerCount(10, 8), (uint16_t)1);
+
+    vis.RemoveViewer(1);
+    ASSERT_FALSE(vis.HasViewer(1));
+    ASSERT_TRUE(vis.IsVisible(10, 11));   // Still seen by viewer 2
+    ASSERT_FALSE(vis.IsVisible(10, 8));
+    ASSERT_TRUE(vis.IsExplored(10, 8));
+    ASSERT_EQUAL(vis.GetViewerCount(10, 8), (uint16_t)0);
+    return {"VisionSystem_SetViewer_RefCountsOverlap", true, ""};
+}
+
+TEST_CASE(VisionSystem_SetViewer_MoveTouchesOnlyEdgeTiles) {
+    LegalCrime::World::VisionSystem vis(40, 40);
+    vis.SetViewer(7, Engine::TilePosition(20, 20), 5);
+    ASSERT_EQUAL(vis.GetChangedTiles().size(), (size_t)81);  // Disc of radius 5
+    vis.ClearChangedTiles();
+
+    // One step east: a column enters, a column leaves
+    vis.SetViewer(7, Engine::TilePosition(20, 21), 5);
+    const auto& changed = vis.GetChangedTiles();
+    ASSERT_TRUE(changed.size() > 0 && changed.size() < 30);
+    bool onlyEdges = true;
+    for (const auto& tile : changed) {
+        bool entered = vis.IsVisible(tile.row, tile.col) && tile.col > 20;
+        bool left = !vis.IsVisible(tile.row, tile.col) && tile.col < 21;
+        onlyEdges = onlyEdges && (entered || left);
+    }
+    ASSERT_TRUE(onlyEdges);
+    ASSERT_TRUE(vis.IsVisible(20, 26));
+    ASSERT_FALSE(vis.IsVisible(20, 15));
+
+    // Same place again: nothing to do
+    vis.ClearChangedTiles();
+    vis.SetViewer(7, Engine::TilePosition(20, 21), 5);
+    ASSERT_EQUAL(vis.GetChangedTiles().size(), (size_t)0);
+    return {"VisionSystem_SetViewer_MoveTouchesOnlyEdgeTiles", true, ""};
+}
+
+TEST_CASE(VisionSystem_ChangedTiles_DropsRevertedTiles) {
+    LegalCrime::World::VisionSystem vis(20, 20);
+    vis.SetViewer(1, Engine::TilePosition(5, 5), 2);
+    vis.ClearChangedTiles();
+
+    // Viewer 1 leaves and viewer 2 arrives on the same spot in one tick
+    vis.RemoveViewer(1);
+    vis.SetViewer(2, Engine::TilePosition(5, 5), 2);
+    ASSERT_EQUAL(vis.GetChangedTiles().size(), (size_t)0);
+    ASSERT_TRUE(vis.IsVisible(5, 5));
+    return {"VisionSystem_ChangedTiles_DropsRevertedTiles", true, ""};
+}
+
+TEST_CASE(VisionSystem_UpdateViewers_FollowsTileChanges) {
+    LegalCrime::World::VisionSystem vis(50, 50);
+    Engine::ECS::ComponentStorage<Engine::TilePosition> tiles;
+    tiles.Add(1, Engine::TilePosition(10, 10));
+    tiles.Add(2, Engine::TilePosition(30, 30));
+
+    vis.UpdateViewers(tiles, 4);
+    ASSERT_TRUE(vis.IsVisible(10, 10));
+    ASSERT_TRUE(vis.IsVisible(30, 30));
+    vis.ClearChangedTiles();
+
+    // Nothing moved: nothing changes
+    vis.UpdateViewers(tiles, 4);
+    ASSERT_EQUAL(vis.GetChangedTiles().size(), (size_t)0);
+
+    // Unit 1 moves, unit 2 is removed
+    *tiles.GetMut(1) = Engine::TilePosition(10, 20);
+    tiles.Remove(2);
+    vis.UpdateViewers(tiles, 4);
+    ASSERT_TRUE(vis.IsVisible(10, 20));
+    ASSERT_FALSE(vis.IsVisible(10, 10));
+    ASSERT_TRUE(vis.IsExplored(10, 10));
+    ASSERT_FALSE(vis.IsVisible(30, 30));
+    ASSERT_FALSE(vis.HasViewer(2));
+    ASSERT_TRUE(vis.GetChangedTiles().size() > 0);
+    return {"VisionSystem_UpdateViewers_FollowsTileChanges", true, ""};
+}
+
+TEST_CASE(VisionSystem_Reset_UpdateViewersRestoresStationaryUnits) {
+    LegalCrime::World::VisionSystem vis(50, 50);
+    Engine::ECS::ComponentStorage<Engine::TilePosition> tiles;
+    tiles.Add(1, Engine::TilePosition(10, 10));
+    vis.UpdateViewers(tiles, 4);
+    vis.UpdateViewers(tiles, 4);  // Cursor now past the unit's last change
+    ASSERT_TRUE(vis.IsVisible(10, 10));
+
+    vis.Reset();
+    ASSERT_FALSE(vis.IsVisible(10, 10));
+    ASSERT_FALSE(vis.HasViewer(1));
+
+    // The unit never moved, yet it sees again
+    vis.UpdateViewers(tiles, 4);
+    ASSERT_TRUE(vis.HasViewer(1));
+    ASSERT_TRUE(vis.IsVisible(10, 10));
+    ASSERT_TRUE(vis.IsVisible(10, 13));
+    ASSERT_EQUAL(vis.GetViewerCount(10, 10), (uint16_t)1);
+    return {"VisionSystem_Reset_UpdateViewersRestoresStationaryUnits", true, ""};
+}
+
+TEST_CASE(VisionSystem_TileMap_WallBlocksSight) {
+    // Wall along column 12, rows 8..12
+    Engine::TileMap tileMap(30, 30, nullptr);
+    for (uint16_t row = 8; row <= 12; ++row) {
+        tileMap.GetTile(row, 12)->SetWalkable(false);
+    }
+    LegalCrime::World::VisionSystem vis(30, 30);
+    vis.SetTileMap(&tileMap);
+    ASSERT_TRUE(vis.IsTileOpaque(10, 12));
+
+    vis.RevealAround(Engine::TilePosition(10, 10), 8);
+    ASSERT_TRUE(vis.IsVisible(10, 10));
+    ASSERT_TRUE(vis.IsVisible(10, 11));
+    ASSERT_TRUE(vis.IsVisible(10, 12));    // The wall itself is seen
+    ASSERT_FALSE(vis.IsVisible(10, 13));   // Behind it is not
+    ASSERT_FALSE(vis.IsVisible(10, 16));
+    ASSERT_TRUE(vis.IsVisible(10, 2));     // Open side keeps the full radius
+    ASSERT_TRUE(vis.IsVisible(5, 13));     // Past the end of the wall
+    return {"VisionSystem_TileMap_WallBlocksSight", true, ""};
+}
+
+TEST_CASE(VisionSystem_Shadowcast_IsSymmetric) {
+    // Scattered pillars; every pair of floor tiles within range must agree
+    const uint16_t size = 24;
+    const uint16_t radius = 7;
+    LegalCrime::World::VisionSystem vis(size, size);
+    for (uint16_t row = 0; row < size; ++row) {
+        for (uint16_t col = 0; col < size; ++col) {
+            if ((row * 7 + col * 13) % 11 == 0) vis.SetTileOpaque(row, col, true);
+        }
+    }
+
+    std::vector<std::vector<uint32_t>> views(static_cast<size_t>(size) * size);
+    for (uint16_t row = 0; row < size; ++row) {
+        for (uint16_t col = 0; col < size; ++col) {
+            if (!vis.IsTileOpaque(row, col)) {
+                vis.ComputeView(Engine::TilePosition(row, col), radius, views[static_cast<size_t>(row) * size + col]);
+            }
+        }
+    }
+    auto sees = [&](uint32_t from, uint32_t to) {
+        const auto& view = views[from];
+        return std::find(view.begin(), view.end(), to) != view.end();
+    };
+
+    bool symmetric = true;
+    bool blockedSome = false;
+    for (uint32_t a = 0; a < views.size(); ++a) {
+        for (uint32_t b : views[a]) {
+            if (!views[b].empty()) symmetric = symmetric && sees(b, a);
+        }
+        blockedSome = blockedSome || (!views[a].empty() && views[a].size() < 149);  // Open disc r7 = 149 tiles
+    }
+    ASSERT_TRUE(symmetric);
+    ASSERT_TRUE(blockedSome);
+    return {"VisionSystem_Shadowcast_IsSymmetric", true, ""};
+}
+
+TEST_CASE(VisionSystem_SetTileOpaque_RecastsViewers) {
+    LegalCrime::World::VisionSystem vis(30, 30);
+    vis.SetViewer(1, Engine::TilePosition(10, 10), 6);
+    ASSERT_TRUE(vis.IsVisible(10, 14));
+
+    // Close a door in front of the viewer: the tiles behind it fog over
+    vis.SetTileOpaque(10, 12, true);
+    ASSERT_TRUE(vis.IsVisible(10, 12));
+    ASSERT_FALSE(vis.IsVisible(10, 14));
+    ASSERT_TRUE(vis.IsExplored(10, 14));
+    ASSERT_EQUAL(vis.GetViewerCount(10, 14), (uint16_t)0);
+
+    // Open it again
+    vis.SetTileOpaque(10, 12, false);
+    ASSERT_TRUE(vis.IsVisible(10, 14));
+
+    // Incremental state matches a fresh sweep with the same walls
+    vis.SetTileOpaque(8, 8, true);
+    vis.SetViewer(1, Engine::TilePosition(12, 11), 6);
+    LegalCrime::World::VisionSystem reference(30, 30);
+    reference.SetTileOpaque(8, 8, true);
+    reference.RevealAround(Engine::TilePosition(12, 11), 6);
+    bool matches = true;
+    for (uint16_t row = 0; row < 30; ++row) {
+        for (uint16_t col = 0; col < 30; ++col) {
+            matches = matches && (reference.IsVisible(row, col) == vis.IsVisible(row, col));
+        }
+    }
+    ASSERT_TRUE(matches);
+    return {"VisionSystem_SetTileOpaque_RecastsViewers", true, ""};
+}
+
+TEST_CASE(VisionSystem_FlushChanges_ClassifiesTransitions) {
+    LegalCrime::World::VisionSystem vis(20, 20);
+    vis.RevealAround(Engine::TilePosition(5, 5), 1);  // 5 tiles, all new
+    const auto& first = vis.FlushChanges();
+    ASSERT_EQUAL(first.becameVisible.size(), (size_t)5);
+    ASSERT_EQUAL(first.firstExplored.size(), (size_t)5);
+    ASSERT_TRUE(first.becameHidden.empty());
+    ASSERT_TRUE(vis.GetChangedTiles().empty());
+
+    // Next tick the unit steps east: the plus shape sheds three tiles and gains three
+    vis.BeginFrame();
+    vis.RevealAround(Engine::TilePosition(5, 6), 1);
+    const auto& second = vis.FlushChanges();
+    ASSERT_EQUAL(second.becameVisible.size(), (size_t)3);   // (4,6), (6,6), (5,7)
+    ASSERT_EQUAL(second.firstExplored.size(), (size_t)3);
+    ASSERT_EQUAL(second.becameHidden.size(), (size_t)3);    // (4,5), (6,5), (5,4)
+    ASSERT_TRUE(second.forgotten.empty());
+
+    // Quiet tick: nothing to publish
+    vis.BeginFrame();
+    vis.RevealAround(Engine::TilePosition(5, 6), 1);
+    ASSERT_TRUE(vis.FlushChanges().Empty());
+
+    vis.Reset();
+    ASSERT_EQUAL(vis.FlushChanges().forgotten.size(), (size_t)8);
+    return {"VisionSystem_FlushChanges_ClassifiesTransitions", true, ""};
+}
+
+TEST_CASE(VisionSystem_PublishSpottedUnits_OnlyNewlyVisibleTiles) {
+    LegalCrime::DomainEventBus().Clear();
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    Engine::CharacterSpriteConfig config;
+    auto* near = world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+        LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr), Engine::TilePosition(4, 4));
+    world.SpawnCharacter(std::make_unique<LegalCrime::Entities::Character>(
+        LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr), Engine::TilePosition(15, 15));
+
+    std::vector<uint32_t> spotted;
+    auto sub = LegalCrime::DomainEventBus().Subscribe<LegalCrime::UnitSpottedEvent>(
+        [&](const LegalCrime::UnitSpottedEvent& e) { spotted.push_back(e.entityId); });
+
+    LegalCrime::World::VisionSystem vis(20, 20);
+    vis.SetViewer(1, Engine::TilePosition(3, 3), 2);
+    vis.FlushChanges();
+    vis.PublishSpottedUnits(world);
+
+    // Still in view next tick: not spotted again
+    vis.FlushChanges();
+    vis.PublishSpottedUnits(world);
+    LegalCrime::DomainEventBus().Unsubscribe<LegalCrime::UnitSpottedEvent>(sub);
+
+    ASSERT_EQUAL(spotted.size(), (size_t)1);
+    ASSERT_EQUAL(spotted[0], near->GetId());
+    return {"VisionSystem_PublishSpottedUnits_OnlyNewlyVisibleTiles", true, ""};
+}
@@ -27,91 +27,115 @@ namespace World {
         }
     }
 
-    void World::AddEntity(std::unique_ptr<Engine::Entity> entity) {
+    Engine::ECS::EntityHandle World::AddEntity(std::unique_ptr<Engine::Entity> entity) {
         if (!entity) {
             if (m_logger) {
                 m_logger->Warning("Attempted to add null entity to world");
             }
-            return;
+            return Engine::ECS::INVALID_HANDLE;
         }
         
         Engine::Entity* raw = entity.get();
         uint32_t id = raw->GetId();
-        m_entities.push_back(std::move(entity));
-        m_entityList.push_back(raw);
-        m_entityMap[id] = raw;
-        m_spatialGrid.Insert(raw);
 
-        // Track characters separately to avoid dynamic_cast during iteration
-        if (auto* character = dynamic_cast<Entities::Character*>(raw)) {
-            m_characters.push_back(character);
+        EntityRecord record;
+        record.entity = std::move(entity);
+        // Classify once here so removal never needs a dynamic_cast
+        record.character = dynamic_cast<Entities::Character*>(raw);
+
+        // Characters' hot state moves into ECS components updated in bulk;
+        // everything else keeps the per-object virtual update.
+        if (record.character) {
+            record.listIndex = static_cast<uint32_t>(m_characters.size());
+            m_characters.push_back(record.character);
+            record.character->BindComponents(&m_characterComponents);
+        } else {
+            record.listIndex = static_cast<uint32_t>(m_updatables.size());
+            m_updatables.push_back(raw);
         }
+
+        Engine::ECS::EntityHandle handle = m_records.Insert(std::move(record));
+        m_entityList.push_back(raw);
+        m_idToHandle.Set(id, handle);
+        m_spatialGrid.Insert(raw);
         
         if (m_logger) {
             m_logger->Debug("Entity added to world. Total entities: " + 
-                          std::to_string(m_entities.size()));
+                          std::to_string(m_records.Size()));
         }
+        return handle;
     }
 
     void World::RemoveEntity(Engine::Entity* entity) {
         if (!entity) {
             return;
         }
-        
+
+        Engine::ECS::EntityHandle handle = m_idToHandle.Find(entity->GetId());
+        const EntityRecord* record = m_records.Get(handle);
+        if (!record || record->entity.get() != entity) {
+            return;
+        }
+        RemoveRecord(handle);
+    }
+
+    bool World::DestroyEntity(Engine::ECS::EntityHandle handle) {
+        if (!m_records.Contains(handle)) {
+            return false;
+        }
+        RemoveRecord(handle);
+        return true;
+    }
+
+    void World::RemoveRecord(Engine::ECS::EntityHandle handle) {
+        EntityRecord* record = m_records.Get(handle);
+        Engine::Entity* entity = record->entity.get();
         uint32_t id = entity->GetId();
+
         m_spatialGrid.Remove(entity);
-        m_entityMap.erase(id);
+        m_idToHandle.Erase(id);
 
         // Remove tile occupancy if this entity was tracked on a tile.
-        auto posIt = m_entityPositions.find(id);
-        if (posIt != m_entityPositions.end()) {
-            m_occupancy.erase(posIt->second);
-            m_entityPositions.erase(posIt);
+        if (record->onTile) {
+            UnlinkOccupant(handle.id, record->tile);
         }
 
-        // Remove from character list
-        if (auto* character = dynamic_cast<Entities::Character*>(entity)) {
-            auto cit = std::find(m_characters.begin(), m_characters.end(), character);
-            if (cit != m_characters.end()) {
-                // Swap-and-pop for O(1) removal
-                *cit = m_characters.back();
-                m_characters.pop_back();
+        // Swap-and-pop from the character or updatable list, fixing the moved entry's index
+        if (record->character) {
+            Entities::Character* moved = m_characters.back();
+            m_characters[record->listIndex] = moved;
+            m_characters.pop_back();
+            if (moved != record->character) {
+                FindRecord(moved->GetId())->listIndex = record->listIndex;
+            }
+        } else {
+            Engine::Entity* moved = m_updatables.back();
+            m_updatables[record->listIndex] = moved;
+            m_updatables.pop_back();
+            if (moved != entity) {
+                FindRecord(moved->GetId())->listIndex = record->listIndex;
             }
         }
 
-        auto it = std::find_if(m_entities.begin(), m_entities.end(),
-            [entity](const std::unique_ptr<Engine::Entity>& e) {
-                return e.get() == entity;
-            });
-        
-        if (it != m_entities.end()) {
-            // Swap-and-pop for O(1) removal from entity list
-            auto lit = std::find(m_entityList.begin(), m_entityList.end(), entity);
-            if (lit != m_entityList.end()) {
-                *lit = m_entityList.back();
-                m_entityList.pop_back();
-            }
-
-            // Swap-and-pop from ownership vector
-            *it = std::move(m_entities.back());
-            m_entities.pop_back();
-            
-            if (m_logger) {
-                m_logger->Debug("Entity removed from world. Remaining entities: " + 
-                              std::to_string(m_entities.size()));
-            }
+        // m_entityList mirrors the slot map's dense order, so swap the same way
+        uint32_t denseIndex = m_records.DenseIndex(handle);
+        m_entityList[denseIndex] = m_entityList.back();
+        m_entityList.pop_back();
 
-            DomainEventBus().Publish(EntityDestroyedEvent{id});
+        // Destroys the entity (characters unbind from their components)
+        m_records.Remove(handle);
+        
+        if (m_logger) {
+            m_logger->Debug("Entity removed from world. Remaining entities: " + 
+                          std::to_string(m_records.Size()));
         }
+
+        DomainEventBus().Publish(EntityDestroyedEvent{id});
     }
 
     bool World::DestroyEntityById(uint32_t id) {
-        Engine::Entity* entity = GetEntityById(id);
-        if (!entity) {
-            return false;
-        }
-        RemoveEntity(entity);
-        return true;
+        Engine::ECS::EntityHandle handle = m_idToHandle.Find(id);
+        return DestroyEntity(handle);
     }
 
     Entities::Character* World::SpawnCharacter(
@@ -140,12 +164,14 @@ namespace World {
 
     void World::ClearEntities() {
         m_spatialGrid.Clear();
-        m_entities.clear();
-        m_entityList.clear();
-        m_entityMap.clear();
         m_characters.clear();
-        m_entityPositions.clear();
-        m_occupancy.clear();
+        m_updatables.clear();
+        m_entityList.clear();
+        m_idToHandle.Clear();
+        std::fill(m_occupancyHeads.begin(), m_occupancyHeads.end(), NPOS);
+        m_occupantLinks.clear();
+        m_overflowOccupants.clear();
+        m_records.Clear();
         
         if (m_logger) {
             m_logger->Debug("World entities cleared");
@@ -153,42 +179,93 @@ namespace World {
     }
 
     Engine::Entity* World::GetEntityById(uint32_t id) {
-        auto it = m_entityMap.find(id);
-        return (it != m_entityMap.end()) ? it->second : nullptr;
+        EntityRecord* record = FindRecord(id);
+        return record ? record->entity.get() : nullptr;
+    }
+
+    Engine::Entity* World::GetEntity(Engine::ECS::EntityHandle handle) {
+        EntityRecord* record = m_records.Get(handle);
+        return record ? record->entity.get() : nullptr;
     }
 
     Entities::Character* World::GetCharacterById(uint32_t id) {
-        Engine::Entity* entity = GetEntityById(id);
-        return entity ? dynamic_cast<Entities::Character*>(entity) : nullptr;
+        EntityRecord* record = FindRecord(id);
+        return record ? record->character : nullptr;
     }
 
     Entities::Character* World::GetCharacterAtTile(const Engine::TilePosition& pos) {
-        auto it = m_occupancy.find(pos);
-        return (it != m_occupancy.end()) ? it->second : nullptr;
+        if (!InOccupancyBounds(pos)) {
+            for (auto it = m_overflowOccupants.rbegin(); it != m_overflowOccupants.rend(); ++it) {
+                if (it->tile == pos) return it->character;
+            }
+            return nullptr;
+        }
+        uint32_t head = OccupancyHead(pos);
+        return (head != NPOS) ? m_occupantLinks[head].character : nullptr;
     }
 
     Entities::Character* World::GetCharacterAtTile(uint16_t row, uint16_t col) {
         return GetCharacterAtTile(Engine::TilePosition(row, col));
     }
 
+    std::vector<Entities::Character*> World::GetCharactersAtTile(const Engine::TilePosition& pos) const {
+        std::vector<Entities::Character*> result;
+        if (!InOccupancyBounds(pos)) {
+            for (auto it = m_overflowOccupants.rbegin(); it != m_overflowOccupants.rend(); ++it) {
+                if (it->tile == pos) result.push_back(it->character);
+            }
+            return result;
+        }
+        for (uint32_t slot = OccupancyHead(pos); slot != NPOS; slot = m_occupantLinks[slot].next) {
+            result.push_back(m_occupantLinks[slot].character);
+        }
+        return result;
+    }
+
+    size_t World::GetOccupantCount(const Engine::TilePosition& pos) const {
+        size_t count = 0;
+        if (!InOccupancyBounds(pos)) {
+            for (const OverflowOccupant& occupant : m_overflowOccupants) {
+                count += (occupant.tile == pos) ? 1 : 0;
+            }
+            return count;
+        }
+        for (uint32_t slot = OccupancyHead(pos); slot != NPOS; slot = m_occupantLinks[slot].next) {
+            ++count;
+        }
+        return count;
+    }
+
     bool World::IsOccupied(const Engine::TilePosition& pos) const {
-        return m_occupancy.find(pos) != m_occupancy.end();
+        if (!InOccupancyBounds(pos)) {
+            return GetOccupantCount(pos) != 0;
+        }
+        return OccupancyHead(pos) != NPOS;
     }
 
     void World::PlaceCharacter(Entities::Character* character, const Engine::TilePosition& pos) {
         if (!character) return;
-        // O(1) removal from old position via reverse lookup
         uint32_t id = character->GetId();
-        Engine::TilePosition oldPos = character->GetTilePosition();
-        bool hadOldPosition = false;
-        auto posIt = m_entityPositions.find(id);
-        if (posIt != m_entityPositions.end()) {
-            m_occupancy.erase(posIt->second);
-            oldPos = posIt->second;
-            hadOldPosition = true;
-        }
-        m_occupancy[pos] = character;
-        m_entityPositions[id] = pos;
+        Engine::ECS::EntityHandle handle = m_idToHandle.Find(id);
+        EntityRecord* record = m_records.Get(handle);
+        if (!record) {
+            if (m_logger) {
+                m_logger->Warning("PlaceCharacter: character is not owned by this world");
+            }
+            return;
+        }
+
+        // O(1) relink via the entity record; no hashing on the tile-step path
+        Engine::TilePosition oldPos = record->tile;
+        bool hadOldPosition = record->onTile;
+        if (!hadOldPosition || oldPos != pos) {
+            if (hadOldPosition) {
+                UnlinkOccupant(handle.id, oldPos);
+            }
+            LinkOccupant(handle.id, character, pos);
+        }
+        record->onTile = true;
+        record->tile = pos;
         character->SetTilePosition(pos);
 
         if (hadOldPosition && oldPos != pos) {
@@ -197,31 +274,145 @@ namespace World {
     }
 
     void World::RemoveOccupant(const Engine::TilePosition& pos) {
-        auto occIt = m_occupancy.find(pos);
-        if (occIt == m_occupancy.end()) {
+        if (!InOccupancyBounds(pos)) {
+            size_t write = 0;
+            for (const OverflowOccupant& occupant : m_overflowOccupants) {
+                if (occupant.tile != pos) {
+                    m_overflowOccupants[write++] = occupant;
+                } else if (EntityRecord* record = FindRecord(occupant.character->GetId())) {
+                    record->onTile = false;
+                }
+            }
+            m_overflowOccupants.resize(write);
             return;
         }
 
-        Entities::Character* character = occIt->second;
-        m_occupancy.erase(occIt);
+        uint32_t& head = m_occupancyHeads[OccupancyIndex(pos)];
+        uint32_t slot = head;
+        head = NPOS;
+        while (slot != NPOS) {
+            OccupantLink& link = m_occupantLinks[slot];
+            uint32_t next = link.next;
+            if (EntityRecord* record = FindRecord(link.character->GetId())) {
+                record->onTile = false;
+            }
+            link = OccupantLink();
+            slot = next;
+        }
+    }
 
-        if (!character) {
+    void World::LinkOccupant(uint32_t slot, Entities::Character* character, const Engine::TilePosition& pos) {
+        if (!InOccupancyBounds(pos)) {
+            // No TileMap (or a position past its edge): grow geometrically to
+            // cover it, within the growth cap; farther out goes to the side list
+            uint32_t needWidth = static_cast<uint32_t>(pos.col) + 1;
+            uint32_t needHeight = static_cast<uint32_t>(pos.row) + 1;
+            uint32_t maxWidth = std::max(m_occupancyWidth, MAX_GROWN_OCCUPANCY_EXTENT);
+            uint32_t maxHeight = std::max(m_occupancyHeight, MAX_GROWN_OCCUPANCY_EXTENT);
+            if (needWidth > maxWidth || needHeight > maxHeight) {
+                m_overflowOccupants.push_back(OverflowOccupant{ slot, character, pos });
+                return;
+            }
+            uint32_t width = std::min(std::max({ needWidth, m_occupancyWidth, m_occupancyWidth * 2u }), maxWidth);
+            uint32_t height = std::min(std::max({ needHeight, m_occupancyHeight, m_occupancyHeight * 2u }), maxHeight);
+            ResizeOccupancy(width, height);
+        }
+        if (slot >= m_occupantLinks.size()) {
+            m_occupantLinks.resize(static_cast<size_t>(slot) + 1);
+        }
+
+        uint32_t& head = m_occupancyHeads[OccupancyIndex(pos)];
+        OccupantLink& link = m_occupantLinks[slot];
+        link.character = character;
+        link.prev = NPOS;
+        link.next = head;
+        if (head != NPOS) {
+            m_occupantLinks[head].prev = slot;
+        }
+        head = slot;
+    }
+
+    void World::UnlinkOccupant(uint32_t slot, const Engine::TilePosition& pos) {
+        if (!InOccupancyBounds(pos)) {
+            auto it = std::find_if(m_overflowOccupants.begin(), m_overflowOccupants.end(),
+                [slot](const OverflowOccupant& occupant) { return occupant.slot == slot; });
+            if (it != m_overflowOccupants.end()) {
+                m_overflowOccupants.erase(it);
+            }
+            return;
+        }
+        if (slot >= m_occupantLinks.size()) {
             return;
         }
 
-        auto posIt = m_entityPositions.find(character->GetId());
-        if (posIt != m_entityPositions.end() && posIt->second == pos) {
-            m_entityPositions.erase(posIt);
+        OccupantLink& link = m_occupantLinks[slot];
+        if (link.prev != NPOS) {
+            m_occupantLinks[link.prev].next = link.next;
+        } else {
+            m_occupancyHeads[OccupancyIndex(pos)] = link.next;
+        }
+        if (link.next != NPOS) {
+            m_occupantLinks[link.next].prev = link.prev;
+        }
+        link = OccupantLink();
+    }
+
+    void World::ResizeOccupancy(uint32_t width, uint32_t height) {
+        std::vector<uint32_t> oldHeads = std::move(m_occupancyHeads);
+        std::vector<OccupantLink> oldLinks = std::move(m_occupantLinks);
+        const uint32_t oldWidth = m_occupancyWidth;
+
+        // Never shrink below an occupied tile
+        for (size_t index = 0; index < oldHeads.size(); ++index) {
+            if (oldHeads[index] != NPOS) {
+                width = std::max(width, static_cast<uint32_t>(index % oldWidth + 1));
+                height = std::max(height, static_cast<uint32_t>(index / oldWidth + 1));
+            }
+        }
+
+        m_occupancyWidth = width;
+        m_occupancyHeight = height;
+        m_occupancyHeads.assign(static_cast<size_t>(width) * height, NPOS);
+        m_occupantLinks.assign(oldLinks.size(), OccupantLink());
+
+        // Relink each tile's list back-to-front so occupant order is preserved
+        std::vector<uint32_t> chain;
+        for (size_t index = 0; index < oldHeads.size(); ++index) {
+            chain.clear();
+            for (uint32_t slot = oldHeads[index]; slot != NPOS; slot = oldLinks[slot].next) {
+                chain.push_back(slot);
+            }
+            Engine::TilePosition pos(static_cast<uint16_t>(index / oldWidth), static_cast<uint16_t>(index % oldWidth));
+            for (auto it = chain.rbegin(); it != chain.rend(); ++it) {
+                LinkOccupant(*it, oldLinks[*it].character, pos);
+            }
+        }
+
+        // Side-list occupants the grid now covers move into it, oldest first
+        std::vector<OverflowOccupant> overflow = std::move(m_overflowOccupants);
+        m_overflowOccupants.clear();
+        for (const OverflowOccupant& occupant : overflow) {
+            if (InOccupancyBounds(occupant.tile)) {
+                LinkOccupant(occupant.slot, occupant.character, occupant.tile);
+            } else {
+                m_overflowOccupants.push_back(occupant);
+            }
         }
     }
 
     void World::SetTileMap(Engine::TileMap* tileMap) {
         m_tileMap = tileMap;
+        if (m_tileMap) {
+            ResizeOccupancy(m_tileMap->GetWidth(), m_tileMap->GetHeight());
+        }
     }
 
     void World::Update(float deltaTime) {
-        // Update all entities
-        for (auto& entity : m_entities) {
+        // Characters: movement interpolation and animation over dense component arrays
+        m_characterComponents.Update(deltaTime);
+
+        // Everything else keeps the per-object virtual update
+        for (Engine::Entity* entity : m_updatables) {
             entity->Update(deltaTime);
         }
     }
@@ -234,8 +425,5 @@ namespace World {
         return m_spatialGrid.QueryRect(rect);
     }
 
-
-    }
-
 } // namespace World
 } // namespace LegalCrime
@@ -4,9 +4,10 @@
 #include "../../Engine/Entity/Entity.h"
 #include "../../Engine/World/SpatialGrid.h"
 #include "../Entities/Character.h"
+#include "../Entities/CharacterComponents.h"
+#include "../../Engine/ECS/SlotMap.h"
 #include <vector>
 #include <memory>
-#include <unordered_map>
 
 namespace Engine {
     class TileMap;
@@ -25,9 +26,10 @@ namespace World {
         World(uint16_t worldWidth, uint16_t worldHeight, uint16_t cellSize = 64, Engine::ILogger* logger = nullptr);
         ~World();
 
-        // Entity management
-        void AddEntity(std::unique_ptr<Engine::Entity> entity);
+        // Entity management — O(1) add/remove/lookup via slot map, no hashing
+        Engine::ECS::EntityHandle AddEntity(std::unique_ptr<Engine::Entity> entity);
         void RemoveEntity(Engine::Entity* entity);
+        bool DestroyEntity(Engine::ECS::EntityHandle handle);
         bool DestroyEntityById(uint32_t id);
         void ClearEntities();
 
@@ -37,15 +39,24 @@ namespace World {
         
         // Entity queries
         Engine::Entity* GetEntityById(uint32_t id);
+        Engine::Entity* GetEntity(Engine::ECS::EntityHandle handle);
+        Engine::ECS::EntityHandle GetHandle(uint32_t id) const { return m_idToHandle.Find(id); }
+        bool IsValid(Engine::ECS::EntityHandle handle) const { return m_records.Contains(handle); }
         const std::vector<Engine::Entity*>& GetAllEntities() const { return m_entityList; }
         
-        // Character queries (O(1) lookups via dedicated maps)
+        // Character queries (O(1) lookups via entity records)
         Entities::Character* GetCharacterById(uint32_t id);
         const std::vector<Entities::Character*>& GetAllCharacters() const { return m_characters; }
-        Entities::Character* GetCharacterAtTile(const Engine::TilePosition& pos);
+        Entities::Character* GetCharacterAtTile(const Engine::TilePosition& pos);  // Most recently placed occupant
         Entities::Character* GetCharacterAtTile(uint16_t row, uint16_t col);
-
-        // Tile occupancy management
+        std::vector<Entities::Character*> GetCharactersAtTile(const Engine::TilePosition& pos) const;
+        size_t GetOccupantCount(const Engine::TilePosition& pos) const;
+
+        // Tile occupancy management — flat grid sized from the TileMap, several
+        // characters may share a tile (RemoveOccupant clears all of them).
+        // Without a TileMap the grid grows to cover placed characters, up to
+        // MAX_GROWN_OCCUPANCY_EXTENT tiles a side; occupants beyond the grid
+        // are kept in a small side list.
         bool IsOccupied(const Engine::TilePosition& pos) const;
         void PlaceCharacter(Entities::Character* character, const Engine::TilePosition& pos);
         void RemoveOccupant(const Engine::TilePosition& pos);
@@ -55,7 +66,7 @@ namespace World {
         Engine::TileMap* GetTileMap() { return m_tileMap; }
         const Engine::TileMap* GetTileMap() const { return m_tileMap; }
 
-        // Update all entities
+        // Update all entities (characters in bulk via ECS systems, others per object)
         void Update(float deltaTime);
 
         // Spatial queries (uses SpatialGrid for O(k) lookups)
@@ -65,19 +76,73 @@ namespace World {
         // Access the spatial grid directly (for advanced usage)
         Engine::SpatialGrid& GetSpatialGrid() { return m_spatialGrid; }
 
+        // ECS storage backing character hot state
+        Entities::CharacterComponents& GetCharacterComponents() { return m_characterComponents; }
+
+        static constexpr uint32_t MAX_GROWN_OCCUPANCY_EXTENT = 1024;
+
     private:
+        static constexpr uint32_t NPOS = UINT32_MAX;
+
+        /// Per-entity bookkeeping owned by the slot map. Indices into the
+        /// character/updatable lists make every removal a swap-and-pop with
+        /// no search and no dynamic_cast.
+        struct EntityRecord {
+            std::unique_ptr<Engine::Entity> entity;
+            Entities::Character* character = nullptr;  // Set once on add
+            uint32_t listIndex = NPOS;                  // m_characters or m_updatables
+            bool onTile = false;                        // Linked into the occupancy grid
+            Engine::TilePosition tile;
+        };
+
+        /// Intrusive doubly linked occupant list node, indexed by slot id.
+        struct OccupantLink {
+            uint32_t next = NPOS;
+            uint32_t prev = NPOS;
+            Entities::Character* character = nullptr;
+        };
+
+        /// Occupant outside the grid, found by scanning.
+        struct OverflowOccupant {
+            uint32_t slot;
+            Entities::Character* character;
+            Engine::TilePosition tile;
+        };
+
+        EntityRecord* FindRecord(uint32_t id) { return m_records.Get(m_idToHandle.Find(id)); }
+        void RemoveRecord(Engine::ECS::EntityHandle handle);
+
+        // Occupancy grid helpers
+        bool InOccupancyBounds(const Engine::TilePosition& pos) const {
+            return pos.row < m_occupancyHeight && pos.col < m_occupancyWidth;
+        }
+        size_t OccupancyIndex(const Engine::TilePosition& pos) const {
+            return static_cast<size_t>(pos.row) * m_occupancyWidth + pos.col;
+        }
+        uint32_t OccupancyHead(const Engine::TilePosition& pos) const {
+            return InOccupancyBounds(pos) ? m_occupancyHeads[OccupancyIndex(pos)] : NPOS;
+        }
+        void LinkOccupant(uint32_t slot, Entities::Character* character, const Engine::TilePosition& pos);
+        void UnlinkOccupant(uint32_t slot, const Engine::TilePosition& pos);
+        void ResizeOccupancy(uint32_t width, uint32_t height);
+
         Engine::ILogger* m_logger;
 
-        // Entity storage — O(1) lookup via hash map, O(n) iteration via dense list
-        std::vector<std::unique_ptr<Engine::Entity>> m_entities;
-        std::vector<Engine::Entity*> m_entityList;  // Fast iteration (raw pointers)
-        std::unordered_map<uint32_t, Engine::Entity*> m_entityMap;  // O(1) by ID
+        // Character hot state (tile, movement, animation). Declared before m_records
+        // so it outlives the characters, which unbind from it on destruction.
+        Entities::CharacterComponents m_characterComponents;
+
+        // Entity storage — slot map with generational handles; m_entityList mirrors
+        // its dense order so GetAllEntities stays a plain pointer vector
+        Engine::ECS::SlotMap<EntityRecord> m_records;
+        std::vector<Engine::Entity*> m_entityList;
+        Engine::ECS::PagedIdMap m_idToHandle;  // Entity::GetId() → handle
 
         // Character-specific list — avoids dynamic_cast scans
         std::vector<Entities::Character*> m_characters;
 
-        // Reverse lookup: entity ID → tile position (O(1) PlaceCharacter old-pos removal)
-        std::unordered_map<uint32_t, Engine::TilePosition> m_entityPositions;
+        // Non-character entities still updated through the virtual Entity::Update
+        std::vector<Engine::Entity*> m_updatables;
 
         // TileMap (not owned by World - owned by scene)
         Engine::TileMap* m_tileMap;
@@ -85,8 +150,13 @@ namespace World {
         // Spatial grid for fast proximity queries
         Engine::SpatialGrid m_spatialGrid;
 
-        // Tile occupancy map for O(1) lookups
-        std::unordered_map<Engine::TilePosition, Entities::Character*, Engine::TilePosition::Hash> m_occupancy;
+        // Tile occupancy: per-tile list head (slot id, NPOS if empty) in a flat
+        // row-major grid, plus per-slot links so a tile can hold several characters
+        std::vector<uint32_t> m_occupancyHeads;
+        std::vector<OccupantLink> m_occupantLinks;
+        uint32_t m_occupancyWidth = 0;
+        uint32_t m_occupancyHeight = 0;
+        std::vector<OverflowOccupant> m_overflowOccupants;  // Outside the grid, oldest first
     };
 
 } // namespace World
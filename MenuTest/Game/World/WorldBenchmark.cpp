@@ -1,7 +1,9 @@
 #include "../../Tests/SimpleTest.h"
 #include "World.h"
 #include "../../Engine/Entity/Entity.h"
+#include "../../Engine/Graphics/CharacterSpriteConfig.h"
 #include <chrono>
+#include <iostream>
 #include <vector>
 
 TEST_CASE(WorldBench_1000_EntityLookup_HotLoop) {
@@ -54,3 +56,160 @@ TEST_CASE(WorldBench_SpawnDestroy_Churn) {
     ASSERT_TRUE(ms < 5000);
     return {"WorldBench_SpawnDestroy_Churn", true, ""};
 }
+
+TEST_CASE(WorldBench_SpawnDestroy_Churn_10k) {
+    LegalCrime::World::World world(2000, 2000, 64, nullptr);
+
+    // Keep a resident population so add/remove cost is measured against 10k live entities
+    std::vector<Engine::Entity*> resident;
+    resident.reserve(10000);
+    for (int i = 0; i < 10000; ++i) {
+        auto e = std::make_unique<Engine::Entity>("resident", nullptr);
+        resident.push_back(e.get());
+        world.AddEntity(std::move(e));
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < 10; ++frame) {
+        std::vector<Engine::Entity*> spawned;
+        spawned.reserve(10000);
+
+        for (int i = 0; i < 10000; ++i) {
+            auto e = std::make_unique<Engine::Entity>("churn", nullptr);
+            spawned.push_back(e.get());
+            world.AddEntity(std::move(e));
+        }
+
+        for (auto* e : spawned) {
+            world.RemoveEntity(e);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+    std::cout << "  [bench] World spawn/destroy churn 10 x 10k over 10k resident: " << ms << " ms" << std::endl;
+    ASSERT_EQUAL(world.GetAllEntities().size(), (size_t)10000);
+    ASSERT_TRUE(ms < 20000);
+    return {"WorldBench_SpawnDestroy_Churn_10k", true, ""};
+}
+
+// ======================== Character Update: per-object vs ECS ========================
+
+namespace {
+
+    constexpr int kCharacterBenchTicks = 60;
+    constexpr float kCharacterBenchDt = 1.0f / 60.0f;
+
+    std::unique_ptr<LegalCrime::Entities::Character> MakeBenchCharacter(int i) {
+        Engine::CharacterSpriteConfig config;
+        auto character = std::make_unique<LegalCrime::Entities::Character>(
+            LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+        character->SetPosition(i % 512, i / 512);
+        return character;
+    }
+
+    // Baseline: characters owned as standalone objects, updated via virtual Entity::Update.
+    long long TimeLegacyCharacterUpdate(int count) {
+        std::vector<std::unique_ptr<Engine::Entity>> characters;
+        characters.reserve(count);
+        for (int i = 0; i < count; ++i) {
+            auto character = MakeBenchCharacter(i);
+            character->MoveTo(1000, 1000, 100.0f);
+            characters.push_back(std::move(character));
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int tick = 0; tick < kCharacterBenchTicks; ++tick) {
+            for (auto& entity : characters) {
+                entity->Update(kCharacterBenchDt);
+            }
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+
+    // ECS: characters bound to World's components, advanced in bulk by World::Update.
+    long long TimeECSCharacterUpdate(int count) {
+        LegalCrime::World::World world(2000, 2000, 64, nullptr);
+        for (int i = 0; i < count; ++i) {
+            auto* character = world.SpawnCharacter(MakeBenchCharacter(i),
+                Engine::TilePosition(static_cast<uint16_t>(i / 256), static_cast<uint16_t>(i % 256)));
+            character->MoveTo(1000, 1000, 100.0f);
+        }
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int tick = 0; tick < kCharacterBenchTicks; ++tick) {
+            world.Update(kCharacterBenchDt);
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    }
+
+    void ReportCharacterUpdate(int count, long long legacyUs, long long ecsUs) {
+        std::cout << "  [bench] character update x" << count << " (" << kCharacterBenchTicks
+                  << " ticks): per-object " << legacyUs << " us, ECS " << ecsUs << " us" << std::endl;
+    }
+
+} // namespace
+
+TEST_CASE(WorldBench_CharacterUpdate_1k) {
+    long long legacyUs = TimeLegacyCharacterUpdate(1000);
+    long long ecsUs = TimeECSCharacterUpdate(1000);
+    ReportCharacterUpdate(1000, legacyUs, ecsUs);
+    ASSERT_TRUE(ecsUs < 2000000);
+    return {"WorldBench_CharacterUpdate_1k", true, ""};
+}
+
+TEST_CASE(WorldBench_CharacterUpdate_10k) {
+    long long legacyUs = TimeLegacyCharacterUpdate(10000);
+    long long ecsUs = TimeECSCharacterUpdate(10000);
+    ReportCharacterUpdate(10000, legacyUs, ecsUs);
+    ASSERT_TRUE(ecsUs < 5000000);
+    return {"WorldBench_CharacterUpdate_10k", true, ""};
+}
+
+TEST_CASE(WorldBench_CharacterUpdate_50k) {
+    long long legacyUs = TimeLegacyCharacterUpdate(50000);
+    long long ecsUs = TimeECSCharacterUpdate(50000);
+    ReportCharacterUpdate(50000, legacyUs, ecsUs);
+    ASSERT_TRUE(ecsUs < 20000000);
+    return {"WorldBench_CharacterUpdate_50k", true, ""};
+}
+
+// ======================== Occupancy updates ========================
+
+TEST_CASE(WorldBench_Occupancy_10kUpdatesPerTick) {
+    LegalCrime::World::World world(2000, 2000, 64, nullptr);
+    Engine::CharacterSpriteConfig config;
+
+    const uint16_t side = 256;
+    std::vector<LegalCrime::Entities::Character*> characters;
+    characters.reserve(10000);
+    for (int i = 0; i < 10000; ++i) {
+        auto c = std::make_unique<LegalCrime::Entities::Character>(
+            LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+        characters.push_back(world.SpawnCharacter(std::move(c),
+            Engine::TilePosition(static_cast<uint16_t>(i / side), static_cast<uint16_t>(i % side))));
+    }
+
+    const int ticks = 60;
+    size_t occupiedHits = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int tick = 0; tick < ticks; ++tick) {
+        // Every character steps one tile east (wrapping), then the destination is queried
+        for (auto* c : characters) {
+            Engine::TilePosition pos = c->GetTilePosition();
+            Engine::TilePosition next(pos.row, static_cast<uint16_t>((pos.col + 1) % side));
+            world.PlaceCharacter(c, next);
+            if (world.IsOccupied(next)) ++occupiedHits;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto us = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+    std::cout << "  [bench] World occupancy 10k place+query per tick: "
+              << (us / ticks) << " us/tick (" << ticks << " ticks)" << std::endl;
+    ASSERT_EQUAL(occupiedHits, (size_t)10000 * ticks);
+    ASSERT_TRUE(us < 10000000);
+    return {"WorldBench_Occupancy_10kUpdatesPerTick", true, ""};
+}
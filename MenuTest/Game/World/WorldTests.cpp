@@ -4,6 +4,7 @@
 #include "../../Engine/Entity/Entity.h"
 #include "../Entities/Character.h"
 #include "../../Engine/Graphics/CharacterSpriteConfig.h"
+#include "../../Engine/World/TileMap.h"
 
 // ======================== World Entity Lookup Tests ========================
 
@@ -281,3 +282,215 @@ TEST_CASE(World_DestroyCharacter_PublishesEntityDestroyedEvent) {
     LegalCrime::DomainEventBus().Unsubscribe<LegalCrime::EntityDestroyedEvent>(sub);
     return {"World_DestroyCharacter_PublishesEntityDestroyedEvent", true, ""};
 }
+
+// ======================== Character ECS Binding Tests ========================
+
+TEST_CASE(World_SpawnCharacter_BindsHotStateToComponents) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    Engine::CharacterSpriteConfig config;
+    auto character = std::make_unique<LegalCrime::Entities::Character>(
+        LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+
+    auto* spawned = world.SpawnCharacter(std::move(character), Engine::TilePosition(6, 7));
+    ASSERT_TRUE(spawned->IsBound());
+
+    auto& components = world.GetCharacterComponents();
+    ASSERT_EQUAL(components.tiles.Size(), (size_t)1);
+    const Engine::TilePosition* tile = components.tiles.Get(spawned->GetComponentHandle().id);
+    ASSERT_NOT_NULL(tile);
+    ASSERT_TRUE(*tile == Engine::TilePosition(6, 7));
+    ASSERT_TRUE(spawned->GetTilePosition() == Engine::TilePosition(6, 7));
+
+    world.DestroyCharacter(spawned);
+    ASSERT_EQUAL(components.tiles.Size(), (size_t)0);
+    ASSERT_EQUAL(components.movements.Size(), (size_t)0);
+    ASSERT_EQUAL(components.entities.GetEntityCount(), (size_t)0);
+    return {"World_SpawnCharacter_BindsHotStateToComponents", true, ""};
+}
+
+TEST_CASE(World_Update_MovesBoundCharacterThroughSystems) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    Engine::CharacterSpriteConfig config;
+    auto character = std::make_unique<LegalCrime::Entities::Character>(
+        LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+
+    auto* spawned = world.SpawnCharacter(std::move(character), Engine::TilePosition(0, 0));
+    spawned->SetPosition(0, 0);
+    spawned->MoveTo(100, 50, 1.0f);
+    ASSERT_TRUE(spawned->IsMoving());
+
+    world.Update(0.5f);
+    ASSERT_TRUE(spawned->GetPosition().x > 0);
+    ASSERT_TRUE(spawned->IsMoving());
+
+    world.Update(1.0f);
+    ASSERT_EQUAL(spawned->GetPosition().x, 100);
+    ASSERT_EQUAL(spawned->GetPosition().y, 50);
+    ASSERT_FALSE(spawned->IsMoving());
+    return {"World_Update_MovesBoundCharacterThroughSystems", true, ""};
+}
+
+// ======================== World Slot-Map Handle Tests ========================
+
+TEST_CASE(World_AddEntity_ReturnsHandle_StaleAfterRemove) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    auto e = std::make_unique<Engine::Entity>("handle", nullptr);
+    uint32_t id = e->GetId();
+    Engine::ECS::EntityHandle handle = world.AddEntity(std::move(e));
+
+    ASSERT_TRUE(world.IsValid(handle));
+    ASSERT_TRUE(world.GetHandle(id) == handle);
+    ASSERT_NOT_NULL(world.GetEntity(handle));
+
+    ASSERT_TRUE(world.DestroyEntity(handle));
+    ASSERT_FALSE(world.IsValid(handle));
+    ASSERT_NULL(world.GetEntity(handle));
+    ASSERT_NULL(world.GetEntityById(id));
+    ASSERT_FALSE(world.DestroyEntity(handle));
+
+    // Slot reuse must not resurrect the old handle
+    auto replacement = world.AddEntity(std::make_unique<Engine::Entity>("reuse", nullptr));
+    ASSERT_TRUE(world.IsValid(replacement));
+    ASSERT_FALSE(world.IsValid(handle));
+    return {"World_AddEntity_ReturnsHandle_StaleAfterRemove", true, ""};
+}
+
+TEST_CASE(World_RemoveEntity_MixedCharactersKeepsListsConsistent) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    Engine::CharacterSpriteConfig config;
+
+    std::vector<LegalCrime::Entities::Character*> characters;
+    for (uint16_t i = 0; i < 6; ++i) {
+        auto c = std::make_unique<LegalCrime::Entities::Character>(
+            LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+        characters.push_back(world.SpawnCharacter(std::move(c), Engine::TilePosition(i, i)));
+        world.AddEntity(std::make_unique<Engine::Entity>("prop", nullptr));
+    }
+
+    world.DestroyCharacter(characters[0]);
+    world.DestroyCharacter(characters[3]);
+    ASSERT_EQUAL(world.GetAllCharacters().size(), (size_t)4);
+    ASSERT_EQUAL(world.GetAllEntities().size(), (size_t)10);
+    ASSERT_FALSE(world.IsOccupied(Engine::TilePosition(0, 0)));
+    ASSERT_TRUE(world.GetCharacterAtTile(Engine::TilePosition(5, 5)) == characters[5]);
+
+    // Moved entries can still be removed correctly
+    world.DestroyCharacter(characters[5]);
+    world.DestroyCharacter(characters[1]);
+    ASSERT_EQUAL(world.GetAllCharacters().size(), (size_t)2);
+    ASSERT_TRUE(world.GetCharacterById(characters[2]->GetId()) == characters[2]);
+    ASSERT_TRUE(world.GetCharacterById(characters[4]->GetId()) == characters[4]);
+    return {"World_RemoveEntity_MixedCharactersKeepsListsConsistent", true, ""};
+}
+
+// ======================== World Occupancy Grid Tests ========================
+
+namespace {
+    LegalCrime::Entities::Character* SpawnTestThug(LegalCrime::World::World& world, const Engine::TilePosition& pos) {
+        Engine::CharacterSpriteConfig config;
+        auto c = std::make_unique<LegalCrime::Entities::Character>(
+            LegalCrime::Entities::CharacterType::Thug, nullptr, config, nullptr);
+        return world.SpawnCharacter(std::move(c), pos);
+    }
+}
+
+TEST_CASE(World_Occupancy_MultipleOccupantsPerTile) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    Engine::TilePosition shared(3, 3);
+    auto* a = SpawnTestThug(world, shared);
+    auto* b = SpawnTestThug(world, shared);
+    auto* c = SpawnTestThug(world, shared);
+
+    ASSERT_EQUAL(world.GetOccupantCount(shared), (size_t)3);
+    ASSERT_TRUE(world.GetCharacterAtTile(shared) == c);  // most recent first
+
+    // Remove from the middle of the list
+    world.PlaceCharacter(b, Engine::TilePosition(4, 4));
+    auto remaining = world.GetCharactersAtTile(shared);
+    ASSERT_EQUAL(remaining.size(), (size_t)2);
+    ASSERT_TRUE(remaining[0] == c);
+    ASSERT_TRUE(remaining[1] == a);
+    ASSERT_TRUE(world.GetCharacterAtTile(Engine::TilePosition(4, 4)) == b);
+
+    world.DestroyCharacter(c);
+    ASSERT_TRUE(world.GetCharacterAtTile(shared) == a);
+
+    world.RemoveOccupant(shared);
+    ASSERT_FALSE(world.IsOccupied(shared));
+    ASSERT_TRUE(world.IsOccupied(Engine::TilePosition(4, 4)));
+    return {"World_Occupancy_MultipleOccupantsPerTile", true, ""};
+}
+
+TEST_CASE(World_Occupancy_GrowsWithoutTileMap) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    auto* near = SpawnTestThug(world, Engine::TilePosition(1, 1));
+    auto* far = SpawnTestThug(world, Engine::TilePosition(300, 500));
+
+    ASSERT_TRUE(world.GetCharacterAtTile(1, 1) == near);
+    ASSERT_TRUE(world.GetCharacterAtTile(300, 500) == far);
+    ASSERT_FALSE(world.IsOccupied(Engine::TilePosition(500, 300)));
+    ASSERT_FALSE(world.IsOccupied(Engine::TilePosition(60000, 60000)));
+    return {"World_Occupancy_GrowsWithoutTileMap", true, ""};
+}
+
+TEST_CASE(World_Occupancy_EdgeOfTileRange_UsesSideList) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    const Engine::TilePosition corner(65535, 65535);
+    const Engine::TilePosition farCol(0, 65535);
+    auto* a = SpawnTestThug(world, corner);
+    auto* b = SpawnTestThug(world, corner);
+    auto* c = SpawnTestThug(world, farCol);
+    auto* near = SpawnTestThug(world, Engine::TilePosition(2, 2));
+
+    ASSERT_TRUE(world.GetCharacterAtTile(corner) == b);  // most recent first
+    ASSERT_EQUAL(world.GetOccupantCount(corner), (size_t)2);
+    ASSERT_TRUE(world.GetCharacterAtTile(farCol) == c);
+    ASSERT_TRUE(world.GetCharacterAtTile(2, 2) == near);
+    ASSERT_FALSE(world.IsOccupied(Engine::TilePosition(65535, 0)));
+
+    // Moving between the grid and the side list keeps both consistent
+    world.PlaceCharacter(a, Engine::TilePosition(2, 2));
+    ASSERT_EQUAL(world.GetOccupantCount(corner), (size_t)1);
+    ASSERT_EQUAL(world.GetOccupantCount(Engine::TilePosition(2, 2)), (size_t)2);
+    world.PlaceCharacter(near, farCol);
+    ASSERT_EQUAL(world.GetOccupantCount(farCol), (size_t)2);
+
+    world.RemoveOccupant(farCol);
+    ASSERT_FALSE(world.IsOccupied(farCol));
+    ASSERT_TRUE(world.DestroyCharacter(b));
+    ASSERT_FALSE(world.IsOccupied(corner));
+
+    // A TileMap covering part of the range leaves the rest in the side list
+    auto* d = SpawnTestThug(world, Engine::TilePosition(40000, 3));
+    Engine::TileMap tileMap(32, 32, nullptr);
+    world.SetTileMap(&tileMap);
+    ASSERT_TRUE(world.GetCharacterAtTile(40000, 3) == d);
+    ASSERT_TRUE(world.GetCharacterAtTile(2, 2) == a);
+    world.SetTileMap(nullptr);
+    return {"World_Occupancy_EdgeOfTileRange_UsesSideList", true, ""};
+}
+
+TEST_CASE(World_Occupancy_SameTilePlace_NoDuplicate) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    auto* a = SpawnTestThug(world, Engine::TilePosition(2, 2));
+    world.PlaceCharacter(a, Engine::TilePosition(2, 2));
+    ASSERT_EQUAL(world.GetOccupantCount(Engine::TilePosition(2, 2)), (size_t)1);
+    return {"World_Occupancy_SameTilePlace_NoDuplicate", true, ""};
+}
+
+TEST_CASE(World_Occupancy_SetTileMapKeepsExistingOccupants) {
+    LegalCrime::World::World world(1000, 1000, 64, nullptr);
+    auto* a = SpawnTestThug(world, Engine::TilePosition(2, 5));
+    auto* b = SpawnTestThug(world, Engine::TilePosition(2, 5));
+
+    Engine::TileMap tileMap(32, 32, nullptr);
+    world.SetTileMap(&tileMap);
+
+    auto occupants = world.GetCharactersAtTile(Engine::TilePosition(2, 5));
+    ASSERT_EQUAL(occupants.size(), (size_t)2);
+    ASSERT_TRUE(occupants[0] == b);
+    ASSERT_TRUE(occupants[1] == a);
+    ASSERT_FALSE(world.IsOccupied(Engine::TilePosition(5, 2)));
+    world.SetTileMap(nullptr);
+    return {"World_Occupancy_SetTileMapKeepsExistingOccupants", true, ""};
+}